@@ -0,0 +1,40 @@
+// Electrical angle and sin/cos for field oriented control without float trigonometry.
+// Raw 14 bit angle maps directly to 16 bit electrical angle, sin/cos taken
+// from interpolated table in flash (Q15 format, 32767 = 1.0).
+// Table size can be changed by defining MT6701_FOC_LUT_BITS (5...8) in build flags.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_foc.h"
+
+#define CS_PIN      9
+#define POLE_PAIRS  7
+
+MT6701 encoder;
+mt6701_foc_t foc;
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  encoder.initializeSSI(CS_PIN);
+
+  mt6701_foc_init(&foc, POLE_PAIRS, 0);
+  // Lock rotor on d axis (apply voltage vector with angle 0), then:
+  mt6701_foc_align(&foc, encoder.angleRawRead());
+}
+
+void loop() {
+  int16_t sin_q15;
+  int16_t cos_q15;
+  uint16_t electrical = mt6701_foc_update(&foc, encoder.angleRawRead(), &sin_q15, &cos_q15);
+
+  Serial.print("electrical: ");
+  Serial.print(electrical);
+  Serial.print("   |    sin: ");
+  Serial.print(sin_q15);
+  Serial.print("   |    cos: ");
+  Serial.println(cos_q15);
+
+  delay(100);
+}
@@ -0,0 +1,45 @@
+// Configures MT6701 in ABZ mode over I2C and counts A/B/Z outputs on this MCU.
+//
+//  Arduino     |      MT6701
+//   PIN2    <----->    A
+//   PIN3    <----->    B
+//   PIN4    <----->    Z (optional, on AVR only pins 2 and 3 have interrupts, so Z set to -1)
+//
+// On ESP32 use beginCounter() to count edges with PCNT hardware without CPU load.
+
+#include <Wire.h>
+#include "MT6701.h"
+#include "MT6701ABZ.h"
+
+#define PULSES_PER_ROUND  256
+#define PIN_A             2
+#define PIN_B             3
+#define PIN_Z             -1
+
+MT6701 encoder;
+MT6701ABZ abz;
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+  encoder.abzModeSet(PULSES_PER_ROUND, MT6701_PULSE_WIDTH_180, MT6701_HYST_1);
+
+  // Pulses per round and Z pulse width must be same as configured in chip
+  if(!abz.beginInterrupt(PIN_A, PIN_B, PIN_Z, PULSES_PER_ROUND, MT6701_PULSE_WIDTH_180)){
+    Serial.println("ABZ decoder init failed");
+  }
+}
+
+void loop() {
+  Serial.print("count: ");
+  Serial.print(abz.countRead());
+  Serial.print("   |    turns: ");
+  Serial.print(abz.turnsRead());
+  Serial.print("   |    angle: ");
+  Serial.print(abz.angleRead());
+  Serial.print("   |    errors: ");
+  Serial.println(abz.errorsRead());
+
+  delay(100);
+}
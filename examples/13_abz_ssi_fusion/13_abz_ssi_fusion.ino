@@ -0,0 +1,54 @@
+// Fast position from ABZ output, corrected with absolute SSI angle 10 times per second.
+// Chip must be configured in ABZ mode with same pulses per round (see example 05_abz_mode),
+// and saved to EEPROM, because I2C pins used by SSI.
+//
+//  Arduino     |      MT6701
+//   PIN2    <----->    A
+//   PIN3    <----->    B
+//   PIN13   <----->    CLK
+//   PIN12   <----->    DO/SDA
+//   PIN9    <----->    CSN
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "MT6701ABZ.h"
+#include "mt6701/mt6701_fusion.h"
+
+#define PULSES_PER_ROUND  256
+#define CS_PIN            9
+
+MT6701 encoder;
+MT6701ABZ abz;
+mt6701_fusion_t fusion;
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  encoder.initializeSSI(CS_PIN);
+  abz.beginInterrupt(2, 3, -1, PULSES_PER_ROUND, MT6701_PULSE_WIDTH_180);
+  // Discrepancy above 64 raw units (~1.4 deg) counted as fault
+  mt6701_fusion_init(&fusion, abz.decoder(), 64);
+}
+
+void loop() {
+  static unsigned long last_correction = 0;
+
+  if(millis() - last_correction >= 100){
+    last_correction = millis();
+    mt6701_sample_t sample;
+    int32_t count_before = abz.countRead();
+    bool valid = encoder.sampleRead(&sample);
+    int32_t count_after = abz.countRead();
+    // Failed read must not move position
+    if(valid){
+      mt6701_fusion_correct(&fusion, sample.angle_raw, count_before + (count_after - count_before) / 2);
+    }
+
+    Serial.print("position: ");
+    Serial.print(mt6701_fusion_position(&fusion, abz.countRead()));
+    Serial.print("   |    error: ");
+    Serial.print(fusion.last_error);
+    Serial.print("   |    faults: ");
+    Serial.println(fusion.faults);
+  }
+}
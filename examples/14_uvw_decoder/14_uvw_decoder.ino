@@ -0,0 +1,41 @@
+// Configures MT6701 in UVW mode over I2C and decodes U/V/W outputs on this MCU.
+// All three pins must support interrupts (ESP32, RP2040, STM32...).
+// If pins placed on same port, lines sampled with single port read.
+//
+//   ESP32     |      MT6701
+//   D25    <----->    U
+//   D26    <----->    V
+//   D27    <----->    W
+
+#include <Wire.h>
+#include "MT6701.h"
+#include "MT6701UVW.h"
+
+#define POLE_PAIRS  4
+
+MT6701 encoder;
+MT6701UVW uvw;
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+  encoder.uvwModeSet(POLE_PAIRS);
+
+  if(!uvw.begin(25, 26, 27, POLE_PAIRS)){
+    Serial.println("UVW decoder init failed");
+  }
+}
+
+void loop() {
+  Serial.print("sector: ");
+  Serial.print(uvw.sectorRead());
+  Serial.print("   |    steps: ");
+  Serial.print(uvw.stepsRead());
+  Serial.print("   |    rpm: ");
+  Serial.print(uvw.rpmRead());
+  Serial.print("   |    errors: ");
+  Serial.println(uvw.errorsRead());
+
+  delay(100);
+}
@@ -0,0 +1,42 @@
+// Configures MT6701 PWM output over I2C and decodes angle from PWM on this MCU.
+// On UNO/Nano Timer1 input capture used (pin 8), on other boards - pin change interrupt.
+//
+//  Arduino     |      MT6701
+//   PIN8    <----->    Analog/PWM
+
+#include <Wire.h>
+#include "MT6701.h"
+#include "MT6701PWM.h"
+
+#define PWM_PIN  8
+
+MT6701 encoder;
+MT6701PWM pwm;
+
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+// Enables beginCapture(): defines Timer1 capture interrupt. Remove if Timer1 used by other code (Servo, ...)
+MT6701_PWM_CAPTURE_ISR()
+#endif
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+  encoder.pwmModeSet(MT6701_PWM_FREQ_994_4, MT6701_PWM_POL_HIGH);
+
+  // Frequency and polarity must be same as configured in chip
+  if(!pwm.beginCapture(MT6701_PWM_FREQ_994_4, MT6701_PWM_POL_HIGH)){
+    pwm.beginInterrupt(PWM_PIN, MT6701_PWM_FREQ_994_4, MT6701_PWM_POL_HIGH);
+  }
+}
+
+void loop() {
+  Serial.print("angle: ");
+  Serial.print(pwm.angleRead());
+  Serial.print("   |    valid: ");
+  Serial.print(pwm.valid());
+  Serial.print("   |    errors: ");
+  Serial.println(pwm.errorsRead());
+
+  delay(100);
+}
@@ -0,0 +1,41 @@
+// Configures MT6701 analog output over I2C and reads angle back with oversampled ADC.
+// Decoder uses same start/stop window, as written to chip.
+//
+//  Arduino     |      MT6701
+//   A0      <----->    Analog/PWM
+
+#include <Wire.h>
+#include "MT6701.h"
+#include "MT6701Analog.h"
+
+#define WINDOW_START  0.0f
+#define WINDOW_STOP   360.0f
+
+MT6701 encoder;
+MT6701Analog analog;
+
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+// Enables beginFreeRunning(): defines ADC interrupt. Remove if ADC interrupt used by other code
+MT6701_ANALOG_FREE_RUNNING_ISR()
+#endif
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+  encoder.analogModeSet(WINDOW_START, WINDOW_STOP);
+
+  // 16 samples per value, 2 extra bits. Free running ADC on UNO/Nano, analogRead() on other boards
+  if(!analog.beginFreeRunning(A0, WINDOW_START, WINDOW_STOP, 4)){
+    analog.begin(A0, WINDOW_START, WINDOW_STOP, 4);
+  }
+}
+
+void loop() {
+  Serial.print("value: ");
+  Serial.print(analog.valueRead());
+  Serial.print("   |    angle: ");
+  Serial.println(analog.angleRead());
+
+  delay(100);
+}
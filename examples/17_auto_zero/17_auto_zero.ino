@@ -0,0 +1,27 @@
+// Sets current shaft position as zero: averages readings, writes offset, verifies
+// by re-reading and saves to chip EEPROM.
+// NB: EEPROM programming requires VDD > 4.5V
+
+#include <Wire.h>
+#include "MT6701.h"
+
+MT6701 encoder;
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+
+  // First argument - readings to average, second - save to EEPROM
+  if(encoder.offsetAuto(256, true)){
+    Serial.println("Zero set");
+  }else{
+    Serial.println("Zero failed");
+  }
+}
+
+void loop() {
+  Serial.print("Angle: ");
+  Serial.println(encoder.angleRead());
+  delay(100);
+}
@@ -0,0 +1,44 @@
+// Streams angle samples as compact binary frames (about 3 bytes per sample instead of 7).
+// Decode on PC with extras/tools/mt6701_telemetry_csv:
+//   mt6701_telemetry_csv capture.bin > samples.csv
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_telemetry.h"
+
+#define CS_PIN	10
+// 115200 baud carries ~11.5 kB/s, ~3800 samples/s at 3 bytes. 2000 leaves margin for key samples and frame overhead
+#define SAMPLE_PERIOD_US	500
+
+MT6701 encoder;
+mt6701_telemetry_encoder_t telemetry;
+uint8_t frame[MT6701_TELEMETRY_MAX_FRAME];
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  encoder.initializeSSI(CS_PIN);
+  mt6701_telemetry_encoder_init(&telemetry);
+}
+
+void loop() {
+  static uint32_t last_sample = 0;
+  mt6701_sample_t sample;
+  uint32_t now;
+  uint16_t len;
+
+  now = micros();
+  if(now - last_sample < SAMPLE_PERIOD_US){
+    return;
+  }
+  last_sample = now;
+
+  if(!encoder.sampleRead(&sample)){
+    return;
+  }
+
+  len = mt6701_telemetry_add(&telemetry, &sample, now, frame, sizeof(frame));
+  if(len){
+    Serial.write(frame, len);
+  }
+}
@@ -0,0 +1,45 @@
+// Records last bus transactions of driver. On read failure (or 'd' from serial monitor)
+// trace dumped as binary, replay it on PC with extras/tools/mt6701_replay:
+//   mt6701_replay trace.bin > samples.csv
+// If retries changed with i2cRetrySet(), pass same count: mt6701_replay trace.bin 3
+
+#include <Wire.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_trace.h"
+
+#define TRACE_ENTRIES	64
+
+MT6701 encoder;
+mt6701_trace_t trace;
+mt6701_trace_entry_t trace_buffer[TRACE_ENTRIES];
+
+static uint32_t trace_micros( void ){
+  return micros();
+}
+
+static void trace_dump( void ){
+  mt6701_trace_entry_t entry;
+
+  mt6701_trace_stop(&trace, encoder.driver());
+  for(uint16_t i = 0; i < trace.count; i++){
+    mt6701_trace_get(&trace, i, &entry);
+    Serial.write((const uint8_t*)&entry, sizeof(entry));
+  }
+  mt6701_trace_start(&trace, encoder.driver(), trace_buffer, TRACE_ENTRIES, trace_micros);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+  mt6701_trace_start(&trace, encoder.driver(), trace_buffer, TRACE_ENTRIES, trace_micros);
+}
+
+void loop() {
+  mt6701_sample_t sample;
+
+  if(!encoder.sampleRead(&sample) || (Serial.read() == 'd')){
+    trace_dump();
+  }
+  delay(10);
+}
@@ -0,0 +1,50 @@
+// Magnet field and track loss watchdog. Status bits extracted from every SSI frame
+// already read for angle, so no extra bus transactions.
+
+#include <SPI.h>
+#include "MT6701.h"
+
+#define CS_PIN		10
+#define FAULT_PIN	13
+
+MT6701 encoder;
+mt6701_watchdog_t watchdog;
+
+static void fault_enter( void *context, uint8_t changed, uint8_t active ){
+  digitalWrite(FAULT_PIN, HIGH);
+  Serial.print("Fault enter: 0x");
+  Serial.println(changed, HEX);
+}
+
+static void fault_exit( void *context, uint8_t changed, uint8_t active ){
+  if(active == 0){
+    digitalWrite(FAULT_PIN, LOW);
+  }
+  Serial.print("Fault exit: 0x");
+  Serial.println(changed, HEX);
+}
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  pinMode(FAULT_PIN, OUTPUT);
+  encoder.initializeSSI(CS_PIN);
+
+  // Fault must persist 5 samples to enter or exit
+  mt6701_watchdog_init(&watchdog, MT6701_WATCHDOG_FAULTS, 5, fault_enter, fault_exit, NULL);
+  encoder.watchdogAttach(&watchdog);
+}
+
+void loop() {
+  float angle = encoder.angleRead();
+
+  if(Serial.read() == 'c'){
+    mt6701_watchdog_clear(&watchdog);
+  }
+
+  Serial.print("Angle: ");
+  Serial.print(angle);
+  Serial.print("   |    latched: 0x");
+  Serial.println(mt6701_watchdog_latched(&watchdog), HEX);
+  delay(100);
+}
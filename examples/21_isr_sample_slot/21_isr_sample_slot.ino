@@ -0,0 +1,55 @@
+// Timer ISR reads encoder over SSI 1000 times per second and publishes sample to slot,
+// loop() copies consistent sample (angle, status and time from same frame) without noInterrupts().
+// Timer2 setup for ATmega328P (Arduino Uno/Nano), other boards need own timer ISR.
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_slot.h"
+
+#define CS_PIN	10
+
+MT6701 encoder;
+mt6701_slot_t slot;
+
+#if defined(__AVR_ATmega328P__)
+ISR(TIMER2_COMPA_vect){
+  mt6701_sample_t sample;
+
+  if(encoder.sampleRead(&sample)){
+    mt6701_slot_write(&slot, &sample, micros());
+  }
+}
+#endif
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  encoder.initializeSSI(CS_PIN);
+  mt6701_slot_init(&slot);
+
+#if defined(__AVR_ATmega328P__)
+  // CTC mode, 16MHz / 128 / 125 = 1kHz
+  TCCR2A = (1 << WGM21);
+  TCCR2B = (1 << CS22) | (1 << CS20);
+  OCR2A = 124;
+  TIMSK2 = (1 << OCIE2A);
+#endif
+}
+
+void loop() {
+  static mt6701_seq_t last_seq = 0;
+  mt6701_sample_t sample;
+  uint32_t time_us;
+  mt6701_seq_t seq;
+
+  if(!mt6701_slot_read(&slot, &sample, &time_us, &seq) || (seq == last_seq)){
+    return;
+  }
+  last_seq = seq;
+
+  Serial.print(time_us);
+  Serial.print(": ");
+  Serial.print(sample.angle_raw);
+  Serial.print("   |    status: 0x");
+  Serial.println(sample.status, HEX);
+}
@@ -0,0 +1,42 @@
+// Finds all MT6701 on I2C buses (default 0x06 and alternate 0x46 address on every bus),
+// checks that they really answer and configures them in one pass.
+// Missing sensors reported at boot.
+
+#include <Wire.h>
+#include "MT6701.h"
+
+#define BUS_COUNT   1
+
+TwoWire *buses[BUS_COUNT] = { &Wire };  // add &Wire1 on boards with second bus
+MT6701 encoders[BUS_COUNT * 2];
+uint32_t found;
+
+static bool configure( MT6701 &encoder ){
+  encoder.directionSet(MT6701_DIRECTION_CW);
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+
+  found = MT6701::discover(buses, BUS_COUNT, encoders, configure);
+
+  for(uint8_t i = 0; i < BUS_COUNT * 2; i++){
+    Serial.print("Bus ");
+    Serial.print(i / 2);
+    Serial.print((i & 1) ? " address 0x46: " : " address 0x06: ");
+    Serial.println((found & (1UL << i)) ? "found" : "MISSING");
+  }
+}
+
+void loop() {
+  for(uint8_t i = 0; i < BUS_COUNT * 2; i++){
+    if(found & (1UL << i)){
+      Serial.print(encoders[i].angleRead());
+      Serial.print("  ");
+    }
+  }
+  Serial.println();
+  delay(100);
+}
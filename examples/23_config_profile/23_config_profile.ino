@@ -0,0 +1,44 @@
+// Copies whole configuration of reference encoder (Wire, address 0x06)
+// to second encoder (Wire, address 0x46) in one call.
+// Profile printed as 10 byte hex string, it can be stored and applied later.
+
+#include <Wire.h>
+#include "MT6701.h"
+
+MT6701 reference;
+MT6701 target;
+
+void setup() {
+  mt6701_profile_t profile;
+  uint8_t blob[MT6701_PROFILE_SERIALIZED_SIZE];
+
+  Serial.begin(115200);
+  Wire.begin();
+  reference.initializeI2C(&Wire, MT6701_DEFAULT_ADDRESS);
+  target.initializeI2C(&Wire, MT6701_ALTERNATE_ADDRESS);
+
+  if(!reference.profileRead(&profile)){
+    Serial.println("Reference read failed");
+    return;
+  }
+
+  mt6701_profile_serialize(&profile, blob, sizeof(blob));
+  Serial.print("Profile: ");
+  for(uint8_t i = 0; i < sizeof(blob); i++){
+    if(blob[i] < 0x10){
+      Serial.print('0');
+    }
+    Serial.print(blob[i], HEX);
+  }
+  Serial.println();
+
+  // Pass true to save to EEPROM
+  Serial.println(target.profileApply(&profile, false) ? "Applied" : "Apply failed");
+}
+
+void loop() {
+  Serial.print(reference.angleRead());
+  Serial.print("  ");
+  Serial.println(target.angleRead());
+  delay(100);
+}
@@ -0,0 +1,53 @@
+// Noise characterization: keep shaft still, sketch reads angles as fast as possible
+// and prints standard deviation, peak to peak, Allan deviation and recommended
+// hysteresis and filter settings. Statistics take fixed memory for any capture length.
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_noise.h"
+
+#define CS_PIN		10
+#define SAMPLES		100000UL
+
+MT6701 encoder;
+mt6701_noise_t noise;
+
+void setup() {
+  mt6701_noise_result_t result;
+  uint32_t start;
+
+  Serial.begin(115200);
+  SPI.begin();
+  encoder.initializeSSI(CS_PIN);
+
+  Serial.println("Capturing, do not move shaft...");
+  mt6701_noise_init(&noise);
+  start = micros();
+  for(uint32_t i = 0; i < SAMPLES; i++){
+    mt6701_noise_add(&noise, encoder.angleRawRead());
+  }
+  float rate = (float)SAMPLES * 1e6f / (float)(micros() - start);
+
+  mt6701_noise_result(&noise, &result);
+  Serial.print("Rate, Hz: ");
+  Serial.println(rate);
+  Serial.print("Sigma, raw: ");
+  Serial.println(result.sigma, 3);
+  Serial.print("Peak to peak, raw: ");
+  Serial.println(result.peak_to_peak);
+  for(uint8_t i = 0; i < result.adev_levels; i++){
+    Serial.print("ADEV ");
+    Serial.print(1UL << i);
+    Serial.print(" samples: ");
+    Serial.println(result.adev[i], 4);
+  }
+  Serial.print("Hysteresis setting: 0x");
+  Serial.println(result.hysteresis, HEX);
+  Serial.print("IIR shift: ");
+  Serial.println(result.iir_shift);
+  Serial.print("Deadband: ");
+  Serial.println(result.deadband);
+}
+
+void loop() {
+}
@@ -0,0 +1,36 @@
+// Register dump for debugging misconfigured units.
+// At start whole dump printed at once. In loop dump read one part per
+// iteration next to angle reading, so control loop never blocked for long.
+
+#include <Wire.h>
+#include "MT6701.h"
+
+MT6701 encoder;
+mt6701_diag_t diag;
+uint32_t last_dump;
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  encoder.initializeI2C();
+
+  encoder.diagnosticPrint(Serial);
+  mt6701_diag_start(&diag);
+}
+
+void loop() {
+  char text[MT6701_DIAG_TEXT_SIZE];
+  // Control loop work
+  Serial.println(encoder.angleRead());
+  delay(10);
+
+  if(millis() - last_dump >= 5000){
+    mt6701_diag_step(&diag, encoder.driver());
+    if(diag.complete){
+      mt6701_diag_format(&diag, text, sizeof(text));
+      Serial.println(text);
+      mt6701_diag_start(&diag);
+      last_dump = millis();
+    }
+  }
+}
@@ -0,0 +1,42 @@
+// Angle read rate over I2C at 100 kHz, 400 kHz and 1 MHz (Fast-mode Plus).
+// Angle registers read in one burst transaction. Pull-ups must be strong
+// enough for selected clock (about 1k for 1 MHz).
+
+#include <Wire.h>
+#include "MT6701.h"
+
+#define SAMPLES   1000
+
+static void rate_measure( uint32_t clock ){
+  uint32_t start;
+
+  // Encoders on one bus share slowest requested clock,
+  // so clocks measured from fastest to slowest
+  MT6701 encoder;
+  encoder.initializeI2C(&Wire, MT6701_DEFAULT_ADDRESS, clock);
+
+  start = micros();
+  for(uint16_t i = 0; i < SAMPLES; i++){
+    encoder.angleRawRead();
+  }
+
+  Serial.print("Requested ");
+  Serial.print(clock);
+  Serial.print(" Hz, actual ");
+  Serial.print(encoder.i2cClockGet());
+  Serial.print(" Hz: ");
+  Serial.print((float)SAMPLES * 1e6f / (float)(micros() - start));
+  Serial.println(" samples/s");
+}
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+
+  rate_measure(1000000);
+  rate_measure(400000);
+  rate_measure(100000);
+}
+
+void loop() {
+}
@@ -0,0 +1,42 @@
+// Two encoders on one SPI bus: one on board, one on long cable.
+// Every encoder gets own fastest reliable SSI clock, found at startup.
+
+#include <SPI.h>
+#include "MT6701.h"
+
+#define CS_PIN_NEAR   9
+#define CS_PIN_FAR    10
+
+MT6701 near_encoder;
+MT6701 far_encoder;
+
+static void tune( MT6701 &encoder, const char *name ){
+  uint32_t clock = encoder.ssiClockTune();
+
+  Serial.print(name);
+  if(clock == 0){
+    Serial.println(": no reliable SSI clock, check wiring");
+    return;
+  }
+  Serial.print(": ");
+  Serial.print(clock);
+  Serial.println(" Hz");
+  encoder.ssiCrcCheckSet(true);
+}
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+  near_encoder.initializeSSI(CS_PIN_NEAR);
+  far_encoder.initializeSSI(CS_PIN_FAR);
+
+  tune(near_encoder, "Near");
+  tune(far_encoder, "Far");
+}
+
+void loop() {
+  Serial.print(near_encoder.angleRead());
+  Serial.print("  ");
+  Serial.println(far_encoder.angleRead());
+  delay(100);
+}
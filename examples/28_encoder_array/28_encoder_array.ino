@@ -0,0 +1,39 @@
+// 12 encoders on one SPI bus, each with own CS pin.
+// Container keeps only 5 bytes per encoder and reads all of them in one sweep.
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "MT6701Array.h"
+
+// Pins 14...16 are A0...A2 on Arduino UNO/Nano
+static const uint8_t cs_pins[] = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 14, 15, 16 };
+#define ENCODERS  (sizeof(cs_pins) / sizeof(cs_pins[0]))
+
+MT6701Array<ENCODERS> encoders;
+
+void setup() {
+  Serial.begin(115200);
+  SPI.begin();
+
+  for(uint8_t i = 0; i < ENCODERS; i++){
+    encoders.add(cs_pins[i]);
+  }
+  encoders.beginSSI(4000000);
+  encoders.busGet().ssiCrcCheckSet(true);
+}
+
+void loop() {
+  uint8_t failed = encoders.readAll();
+
+  for(uint8_t i = 0; i < encoders.count(); i++){
+    if(encoders.stale(i)){
+      Serial.print("----");
+    }else{
+      Serial.print(encoders.angleRawRead(i));
+    }
+    Serial.print(' ');
+  }
+  Serial.print(" failed: ");
+  Serial.println(failed);
+  delay(20);
+}
@@ -0,0 +1,58 @@
+// Absolute multi-turn position without homing: main shaft gear 32 teeth drives
+// secondary gear 31 teeth, each shaft has own MT6701 (SSI). Pair of angles is
+// unique over 31 main shaft turns. Secondary gear meshes directly, so rotates opposite.
+
+#include <SPI.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_vernier.h"
+
+#define CS_PIN_MAIN       9
+#define CS_PIN_SECONDARY  10
+
+MT6701 main_encoder;
+MT6701 secondary_encoder;
+mt6701_vernier_t vernier;
+
+void setup() {
+  static const uint16_t teeth[2] = { 32, 31 };
+
+  Serial.begin(115200);
+  SPI.begin();
+  main_encoder.initializeSSI(CS_PIN_MAIN, 4000000);
+  secondary_encoder.initializeSSI(CS_PIN_SECONDARY, 4000000);
+
+  // Bit 1 - secondary sensor reversed
+  if(mt6701_vernier_init(&vernier, teeth, 2, 0x02) != MT6701_OK){
+    Serial.println("Teeth counts must be coprime");
+    while(1){
+      delay(1000);
+    }
+  }
+}
+
+void loop() {
+  mt6701_vernier_result_t result;
+  mt6701_sample_t samples[2];
+  uint16_t angles[2];
+
+  // Read back to back, shaft movement between readings adds to residual
+  if(!main_encoder.sampleRead(&samples[0]) || !secondary_encoder.sampleRead(&samples[1])){
+    Serial.println("Read failed");
+    delay(50);
+    return;
+  }
+  angles[0] = samples[0].angle_raw;
+  angles[1] = samples[1].angle_raw;
+
+  if(mt6701_vernier_solve(&vernier, angles, &result) != MT6701_OK){
+    Serial.print("Inconsistent readings, residual ");
+    Serial.println(result.residual);
+  }else{
+    Serial.print("Turn ");
+    Serial.print(result.turn);
+    Serial.print(", position ");
+    Serial.print((float)result.position * (360.0f / 16384.0f));
+    Serial.println(" deg");
+  }
+  delay(50);
+}
@@ -0,0 +1,145 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Sample rate benchmark for Linux backends.
+// Build:
+//   cc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -I../../src/mt6701 mt6701_bench.c mt6701_linux.c mt6701_sim.c ../../src/mt6701/mt6701.c -o mt6701_bench
+// Usage:
+//   mt6701_bench i2c /dev/i2c-1 [samples] [address]
+//   mt6701_bench spi /dev/spidev0.0 [samples] [speed_hz|tune]
+//   mt6701_bench i2c sim:i2c        (software simulator, no hardware needed)
+// For I2C both burst (one I2C_RDWR per angle) and per register reads measured.
+// With "tune" SSI clock selected by mt6701_ssi_clock_tune, frames checked with CRC6.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mt6701_linux.h"
+#include "mt6701_sim.h"
+
+static uint64_t time_ns( void ){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_run( const char *name, mt6701_handle_t *handle, unsigned long samples ){
+	uint64_t start;
+	uint64_t begin;
+	uint64_t elapsed;
+	uint64_t latency;
+	uint64_t latency_min = UINT64_MAX;
+	uint64_t latency_max = 0;
+	unsigned long errors = 0;
+	unsigned long i;
+	uint16_t angle_raw;
+
+	begin = time_ns();
+	for(i = 0; i < samples; i++){
+		start = time_ns();
+		if(mt6701_read_raw(handle, &angle_raw, NULL, NULL, NULL) != MT6701_OK){
+			errors++;
+		}
+		latency = time_ns() - start;
+		if(latency < latency_min){
+			latency_min = latency;
+		}
+		if(latency > latency_max){
+			latency_max = latency;
+		}
+	}
+	elapsed = time_ns() - begin;
+
+	printf("%-10s samples: %lu, errors: %lu, rate: %.0f samples/s, latency us min/mean/max: %.1f/%.1f/%.1f\n",
+		name, samples, errors,
+		(double)samples * 1e9 / (double)elapsed,
+		(double)latency_min / 1000.0, (double)elapsed / (double)samples / 1000.0, (double)latency_max / 1000.0);
+}
+
+int main( int argc, char **argv ){
+	mt6701_handle_t handle;
+	mt6701_linux_i2c_t i2c;
+	mt6701_linux_spi_t spi;
+	const mt6701_linux_ops_t *ops = NULL;
+	unsigned long samples = 10000;
+	unsigned long param = 0;
+	bool tune = false;
+	uint32_t clock;
+	static const uint32_t clocks[] = { 250000, 500000, 1000000, 2000000, 4000000, 8000000 };
+
+	if(argc < 3){
+		fprintf(stderr, "Usage: %s i2c|spi <device> [samples] [address|speed_hz]\n", argv[0]);
+		return 2;
+	}
+	if(argc > 3){
+		samples = strtoul(argv[3], NULL, 0);
+	}
+	if(argc > 4){
+		tune = (strcmp(argv[4], "tune") == 0);
+		param = tune ? 0 : strtoul(argv[4], NULL, 0);
+	}
+	if(mt6701_sim_path(argv[2])){
+		ops = &mt6701_sim_ops;
+	}
+
+	memset(&handle, 0, sizeof(handle));
+
+	if(strcmp(argv[1], "i2c") == 0){
+		if(mt6701_linux_i2c_open(&i2c, &handle, argv[2], (param != 0) ? (uint8_t)param : MT6701_DEFAULT_ADDRESS, ops) != MT6701_OK){
+			fprintf(stderr, "Can't open %s\n", argv[2]);
+			return 1;
+		}
+		bench_run("burst", &handle, samples);
+		// Same bus, ANGLE6 and ANGLE0 as separate transactions
+		handle.i2c_read_burst = NULL;
+		bench_run("register", &handle, samples);
+		mt6701_linux_i2c_close(&i2c);
+	}else if(strcmp(argv[1], "spi") == 0){
+		if(mt6701_linux_spi_open(&spi, &handle, argv[2], (uint32_t)param, ops) != MT6701_OK){
+			fprintf(stderr, "Can't open %s\n", argv[2]);
+			return 1;
+		}
+		if(tune){
+			if(mt6701_ssi_clock_tune(&handle, clocks, sizeof(clocks) / sizeof(clocks[0]), 1000, &clock) != MT6701_OK){
+				fprintf(stderr, "No reliable SSI clock\n");
+				mt6701_linux_spi_close(&spi);
+				return 1;
+			}
+			mt6701_ssi_crc_check_set(&handle, true);
+		}
+		printf("SSI clock: %lu Hz\n", (unsigned long)spi.speed_hz);
+		bench_run("ssi", &handle, samples);
+		mt6701_linux_spi_close(&spi);
+	}else{
+		fprintf(stderr, "Unknown interface %s\n", argv[1]);
+		return 2;
+	}
+
+	return 0;
+}
@@ -0,0 +1,239 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_linux.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+static int mt6701_linux_sys_open( const char *path, int flags ){
+	return open(path, flags);
+}
+
+static int mt6701_linux_sys_close( int fd ){
+	return close(fd);
+}
+
+static int mt6701_linux_sys_ioctl( int fd, unsigned long request, void *arg ){
+	return ioctl(fd, request, arg);
+}
+
+const mt6701_linux_ops_t mt6701_linux_ops_system = {
+	mt6701_linux_sys_open,
+	mt6701_linux_sys_close,
+	mt6701_linux_sys_ioctl,
+};
+
+static void mt6701_linux_delay( uint32_t ms ){
+	struct timespec ts;
+
+	ts.tv_sec = ms / 1000;
+	ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+	nanosleep(&ts, NULL);
+}
+
+static void mt6701_linux_delay_us( uint32_t us ){
+	struct timespec ts;
+
+	ts.tv_sec = us / 1000000;
+	ts.tv_nsec = (long)(us % 1000000) * 1000L;
+	nanosleep(&ts, NULL);
+}
+
+static uint8_t mt6701_linux_i2c_read_burst( void *obj, uint8_t reg, uint8_t *data, uint8_t len ){
+	mt6701_linux_i2c_t *dev = (mt6701_linux_i2c_t*)obj;
+	struct i2c_msg msgs[2];
+	struct i2c_rdwr_ioctl_data xfer;
+
+	msgs[0].addr = dev->address;
+	msgs[0].flags = 0;
+	msgs[0].len = 1;
+	msgs[0].buf = &reg;
+	msgs[1].addr = dev->address;
+	msgs[1].flags = I2C_M_RD;
+	msgs[1].len = len;
+	msgs[1].buf = data;
+	xfer.msgs = msgs;
+	xfer.nmsgs = 2;
+
+	if(dev->ops->ioctl(dev->fd, I2C_RDWR, &xfer) != 2){
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint8_t mt6701_linux_i2c_read( void *obj, uint8_t reg, uint8_t *data ){
+	return mt6701_linux_i2c_read_burst(obj, reg, data, 1);
+}
+
+static uint8_t mt6701_linux_i2c_write( void *obj, uint8_t reg, uint8_t data ){
+	mt6701_linux_i2c_t *dev = (mt6701_linux_i2c_t*)obj;
+	struct i2c_msg msg;
+	struct i2c_rdwr_ioctl_data xfer;
+	uint8_t buf[2];
+
+	buf[0] = reg;
+	buf[1] = data;
+	msg.addr = dev->address;
+	msg.flags = 0;
+	msg.len = 2;
+	msg.buf = buf;
+	xfer.msgs = &msg;
+	xfer.nmsgs = 1;
+
+	if(dev->ops->ioctl(dev->fd, I2C_RDWR, &xfer) != 1){
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint8_t mt6701_linux_spi_read( void *obj, uint8_t *data, uint8_t len ){
+	mt6701_linux_spi_t *dev = (mt6701_linux_spi_t*)obj;
+	struct spi_ioc_transfer xfer;
+
+	memset(&xfer, 0, sizeof(xfer));
+	memset(data, 0xFF, len);
+	xfer.tx_buf = (unsigned long)data;
+	xfer.rx_buf = (unsigned long)data;
+	xfer.len = len;
+	xfer.speed_hz = dev->speed_hz;
+	xfer.bits_per_word = 8;
+
+	if(dev->ops->ioctl(dev->fd, SPI_IOC_MESSAGE(1), &xfer) != (int)len){
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint8_t mt6701_linux_spi_clock_set( void *obj, uint32_t clock ){
+	mt6701_linux_spi_t *dev = (mt6701_linux_spi_t*)obj;
+
+	// Used as speed_hz of every transfer
+	dev->speed_hz = clock;
+
+	return 0;
+}
+
+uint8_t mt6701_linux_i2c_open( mt6701_linux_i2c_t *dev, mt6701_handle_t *handle, const char *path, uint8_t address, const mt6701_linux_ops_t *ops ){
+	uint8_t res;
+
+	if((dev == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	dev->ops = (ops != NULL) ? ops : &mt6701_linux_ops_system;
+	dev->address = address;
+	dev->fd = dev->ops->open(path, O_RDWR);
+	if(dev->fd < 0){
+		return MT6701_ERR_IO;
+	}
+
+	handle->i2c_object = dev;
+	handle->i2c_read = mt6701_linux_i2c_read;
+	handle->i2c_write = mt6701_linux_i2c_write;
+	handle->i2c_read_burst = mt6701_linux_i2c_read_burst;
+	handle->delay = mt6701_linux_delay;
+	handle->delay_us = mt6701_linux_delay_us;
+
+	res = mt6701_interface_set(handle, MT6701_INTERFACE_I2C);
+	if(res == MT6701_OK){
+		res = mt6701_init(handle);
+	}
+	if(res != MT6701_OK){
+		mt6701_linux_i2c_close(dev);
+	}
+
+	return res;
+}
+
+void mt6701_linux_i2c_close( mt6701_linux_i2c_t *dev ){
+	if((dev == NULL) || (dev->fd < 0)){
+		return;
+	}
+
+	dev->ops->close(dev->fd);
+	dev->fd = -1;
+}
+
+uint8_t mt6701_linux_spi_open( mt6701_linux_spi_t *dev, mt6701_handle_t *handle, const char *path, uint32_t speed_hz, const mt6701_linux_ops_t *ops ){
+	uint8_t mode = SPI_MODE_1;
+	uint8_t bits = 8;
+	uint8_t res;
+
+	if((dev == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	dev->ops = (ops != NULL) ? ops : &mt6701_linux_ops_system;
+	dev->speed_hz = (speed_hz != 0) ? speed_hz : MT6701_LINUX_SPI_SPEED_HZ;
+	dev->fd = dev->ops->open(path, O_RDWR);
+	if(dev->fd < 0){
+		return MT6701_ERR_IO;
+	}
+
+	if((dev->ops->ioctl(dev->fd, SPI_IOC_WR_MODE, &mode) < 0) ||
+	   (dev->ops->ioctl(dev->fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+	   (dev->ops->ioctl(dev->fd, SPI_IOC_WR_MAX_SPEED_HZ, &dev->speed_hz) < 0)){
+		mt6701_linux_spi_close(dev);
+		return MT6701_ERR_IO;
+	}
+
+	handle->ssi_object = dev;
+	handle->ssi_read_obj = mt6701_linux_spi_read;
+	handle->ssi_clock_set = mt6701_linux_spi_clock_set;
+	handle->ssi_clock = dev->speed_hz;
+	handle->delay = mt6701_linux_delay;
+	handle->delay_us = mt6701_linux_delay_us;
+
+	res = mt6701_interface_set(handle, MT6701_INTERFACE_SSI);
+	if(res == MT6701_OK){
+		res = mt6701_init(handle);
+	}
+	if(res != MT6701_OK){
+		mt6701_linux_spi_close(dev);
+	}
+
+	return res;
+}
+
+void mt6701_linux_spi_close( mt6701_linux_spi_t *dev ){
+	if((dev == NULL) || (dev->fd < 0)){
+		return;
+	}
+
+	dev->ops->close(dev->fd);
+	dev->fd = -1;
+}
@@ -0,0 +1,96 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_LINUX_H__
+#define MT6701_LINUX_H__
+
+// Linux backends for mt6701_handle_t: /dev/i2c-N (i2c-dev) and /dev/spidevX.Y (spidev)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+#ifndef MT6701_LINUX_SPI_SPEED_HZ
+#define MT6701_LINUX_SPI_SPEED_HZ			1000000
+#endif
+
+// Device access, replaced by simulator (mt6701_sim.h) for tests without hardware
+typedef struct{
+	int (*open)( const char *path, int flags );
+	int (*close)( int fd );
+	int (*ioctl)( int fd, unsigned long request, void *arg );
+} mt6701_linux_ops_t;
+
+typedef struct{
+	const mt6701_linux_ops_t *ops;
+	int fd;
+	uint8_t address;
+} mt6701_linux_i2c_t;
+
+typedef struct{
+	const mt6701_linux_ops_t *ops;
+	int fd;
+	uint32_t speed_hz;
+} mt6701_linux_spi_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+extern const mt6701_linux_ops_t mt6701_linux_ops_system;
+
+/// @brief Open i2c-dev bus and init handler. Register reads done as combined (repeated start) I2C_RDWR transactions, angle read with one ioctl
+/// @param dev Device handler, must live as long as mt6701 handler
+/// @param handle mt6701 handler
+/// @param path Bus device, e.g. "/dev/i2c-1"
+/// @param address Chip address, MT6701_DEFAULT_ADDRESS or alternate
+/// @param ops Device access, NULL - system calls
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_linux_i2c_open( mt6701_linux_i2c_t *dev, mt6701_handle_t *handle, const char *path, uint8_t address, const mt6701_linux_ops_t *ops );
+
+/// @brief Close i2c-dev bus
+/// @param dev Device handler
+void mt6701_linux_i2c_close( mt6701_linux_i2c_t *dev );
+
+/// @brief Open spidev device and init handler for SSI. CS handled by spidev, one SPI_IOC_MESSAGE per frame
+/// @param dev Device handler, must live as long as mt6701 handler
+/// @param handle mt6701 handler
+/// @param path SPI device, e.g. "/dev/spidev0.0"
+/// @param speed_hz SSI clock, 0 - MT6701_LINUX_SPI_SPEED_HZ
+/// @param ops Device access, NULL - system calls
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_linux_spi_open( mt6701_linux_spi_t *dev, mt6701_handle_t *handle, const char *path, uint32_t speed_hz, const mt6701_linux_ops_t *ops );
+
+/// @brief Close spidev device
+/// @param dev Device handler
+void mt6701_linux_spi_close( mt6701_linux_spi_t *dev );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_LINUX_H__
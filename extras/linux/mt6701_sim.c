@@ -0,0 +1,208 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+#define MT6701_SIM_FD_BASE					1000
+
+static struct{
+	uint8_t regs[256];
+	uint8_t pointer;
+	uint8_t status;
+	uint8_t address;
+	float rpm;
+	uint32_t ssi_max_hz;
+} mt6701_sim = { {0}, 0, 0, MT6701_DEFAULT_ADDRESS, 60.0f, MT6701_SIM_SSI_MAX_HZ };
+
+static uint16_t mt6701_sim_angle( void ){
+	struct timespec ts;
+	double turns;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	turns = ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9) * mt6701_sim.rpm / 60.0;
+	turns -= (double)(int64_t)turns;
+	if(turns < 0.0){
+		turns += 1.0;
+	}
+
+	return (uint16_t)(turns * 16384.0) & 0x3FFF;
+}
+
+// CRC6 of SSI frame: x^6 + x + 1 over 18 bits of angle and status
+static uint8_t mt6701_sim_crc6( uint32_t data ){
+	uint8_t crc = 0;
+	int8_t i;
+	uint8_t bit;
+
+	for(i = 17; i >= 0; i--){
+		bit = (uint8_t)(((data >> i) & 1) ^ ((crc >> 5) & 1));
+		crc = (uint8_t)((crc << 1) & 0x3F);
+		if(bit){
+			crc ^= 0x03;
+		}
+	}
+
+	return crc;
+}
+
+static uint8_t mt6701_sim_reg_read( uint8_t reg, uint16_t angle ){
+	if(reg == MT6701_REG_ANGLE6){
+		return (uint8_t)(angle >> 6);
+	}
+	if(reg == MT6701_REG_ANGLE0){
+		return (uint8_t)((angle & 0x3F) << MT6701_REG_ANGLE0_POS);
+	}
+
+	return mt6701_sim.regs[reg];
+}
+
+static int mt6701_sim_i2c_rdwr( struct i2c_rdwr_ioctl_data *xfer ){
+	uint16_t angle;
+	uint32_t i;
+	uint16_t j;
+	struct i2c_msg *msg;
+
+	// Angle latched once per transaction, so ANGLE6/ANGLE0 burst consistent
+	angle = mt6701_sim_angle();
+
+	for(i = 0; i < xfer->nmsgs; i++){
+		msg = &xfer->msgs[i];
+		if(msg->addr != mt6701_sim.address){
+			errno = ENXIO;
+			return -1;
+		}
+
+		if(msg->flags & I2C_M_RD){
+			for(j = 0; j < msg->len; j++){
+				msg->buf[j] = mt6701_sim_reg_read(mt6701_sim.pointer++, angle);
+			}
+		}else if(msg->len > 0){
+			mt6701_sim.pointer = msg->buf[0];
+			for(j = 1; j < msg->len; j++){
+				mt6701_sim.regs[mt6701_sim.pointer++] = msg->buf[j];
+			}
+		}
+	}
+
+	return (int)xfer->nmsgs;
+}
+
+static int mt6701_sim_spi_message( struct spi_ioc_transfer *xfer ){
+	uint8_t *rx = (uint8_t*)(uintptr_t)xfer->rx_buf;
+	uint32_t frame;
+	uint16_t angle;
+
+	if(xfer->len != 3){
+		errno = EINVAL;
+		return -1;
+	}
+
+	angle = mt6701_sim_angle();
+	frame = ((uint32_t)angle << 4) | (mt6701_sim.status & 0x0F);
+	frame = (frame << 6) | mt6701_sim_crc6(frame);
+
+	// Too fast clock: data sampled one bit late, first bit read as pull-up level
+	if((mt6701_sim.ssi_max_hz != 0) && (xfer->speed_hz > mt6701_sim.ssi_max_hz)){
+		frame = (frame >> 1) | 0x800000;
+	}
+
+	rx[0] = (uint8_t)(frame >> 16);
+	rx[1] = (uint8_t)(frame >> 8);
+	rx[2] = (uint8_t)frame;
+
+	return 3;
+}
+
+static int mt6701_sim_open( const char *path, int flags ){
+	(void)flags;
+
+	if(strcmp(path, MT6701_SIM_PATH_PREFIX "i2c") == 0){
+		return MT6701_SIM_FD_BASE;
+	}
+	if(strcmp(path, MT6701_SIM_PATH_PREFIX "spi") == 0){
+		return MT6701_SIM_FD_BASE + 1;
+	}
+
+	errno = ENOENT;
+	return -1;
+}
+
+static int mt6701_sim_close( int fd ){
+	(void)fd;
+	return 0;
+}
+
+static int mt6701_sim_ioctl( int fd, unsigned long request, void *arg ){
+	if(fd == MT6701_SIM_FD_BASE){
+		if(request == I2C_RDWR){
+			return mt6701_sim_i2c_rdwr((struct i2c_rdwr_ioctl_data*)arg);
+		}
+	}else if(fd == MT6701_SIM_FD_BASE + 1){
+		if(request == SPI_IOC_MESSAGE(1)){
+			return mt6701_sim_spi_message((struct spi_ioc_transfer*)arg);
+		}
+		if((request == SPI_IOC_WR_MODE) || (request == SPI_IOC_WR_BITS_PER_WORD) || (request == SPI_IOC_WR_MAX_SPEED_HZ)){
+			return 0;
+		}
+	}
+
+	errno = ENOTTY;
+	return -1;
+}
+
+const mt6701_linux_ops_t mt6701_sim_ops = {
+	mt6701_sim_open,
+	mt6701_sim_close,
+	mt6701_sim_ioctl,
+};
+
+bool mt6701_sim_path( const char *path ){
+	return strncmp(path, MT6701_SIM_PATH_PREFIX, strlen(MT6701_SIM_PATH_PREFIX)) == 0;
+}
+
+void mt6701_sim_speed_set( float rpm ){
+	mt6701_sim.rpm = rpm;
+}
+
+void mt6701_sim_ssi_max_set( uint32_t max_hz ){
+	mt6701_sim.ssi_max_hz = max_hz;
+}
+
+void mt6701_sim_status_set( uint8_t status ){
+	mt6701_sim.status = status;
+}
+
+uint8_t mt6701_sim_reg_get( uint8_t reg ){
+	return mt6701_sim.regs[reg];
+}
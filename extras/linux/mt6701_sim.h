@@ -0,0 +1,77 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_SIM_H__
+#define MT6701_SIM_H__
+
+// Software MT6701 behind mt6701_linux_ops_t: answers I2C_RDWR transactions (register file
+// with auto increment) and spidev SSI frames, angle rotates with set speed.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701_linux.h"
+
+#define MT6701_SIM_PATH_PREFIX				"sim:"
+
+// SSI frames corrupted above this clock (simulated long cable), for clock tuning tests
+#ifndef MT6701_SIM_SSI_MAX_HZ
+#define MT6701_SIM_SSI_MAX_HZ				5000000
+#endif
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+extern const mt6701_linux_ops_t mt6701_sim_ops;
+
+/// @brief Check if device path addresses simulator ("sim:i2c", "sim:spi")
+/// @param path Device path
+/// @return True for simulator path
+bool mt6701_sim_path( const char *path );
+
+/// @brief Set simulated shaft speed
+/// @param rpm Rotations per minute, negative - backward
+void mt6701_sim_speed_set( float rpm );
+
+/// @brief Set max SSI clock, faster transfers return frames shifted by one bit
+/// @param max_hz Clock, Hz, 0 - no limit
+void mt6701_sim_ssi_max_set( uint32_t max_hz );
+
+/// @brief Set simulated status bits, reported in SSI frame
+/// @param status MT6701_SAMPLE_x bits (field, button, track loss)
+void mt6701_sim_status_set( uint8_t status );
+
+/// @brief Direct access to simulated register file
+/// @param reg Register
+/// @return Register value
+uint8_t mt6701_sim_reg_get( uint8_t reg );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_SIM_H__
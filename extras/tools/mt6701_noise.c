@@ -0,0 +1,147 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Noise characterization of recorded stationary capture.
+// Build:
+//   cc -std=c99 -O2 -I../../src/mt6701 mt6701_noise.c ../../src/mt6701/mt6701_noise.c ../../src/mt6701/mt6701.c -lm -o mt6701_noise
+// Usage:
+//   mt6701_noise [capture.csv] [rate_hz]   (stdin if no file or "-")
+// Input: one raw angle per line, or mt6701_telemetry_csv output (angle_raw column). Other lines skipped
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mt6701_noise.h"
+
+static const char *hyst_name( mt6701_hyst_t hysteresis ){
+	switch(hysteresis){
+		case MT6701_HYST_0_25:	return "MT6701_HYST_0_25";
+		case MT6701_HYST_0_5:	return "MT6701_HYST_0_5";
+		case MT6701_HYST_1:		return "MT6701_HYST_1";
+		case MT6701_HYST_2:		return "MT6701_HYST_2";
+		case MT6701_HYST_4:		return "MT6701_HYST_4";
+		case MT6701_HYST_8:		return "MT6701_HYST_8";
+		default:				return "?";
+	}
+}
+
+static bool line_parse( const char *line, uint16_t *angle_raw ){
+	const char *field = line;
+	const char *comma;
+	char *end;
+	long value;
+
+	// Telemetry CSV: time_us,angle_raw,...
+	comma = strchr(line, ',');
+	if(comma != NULL){
+		field = comma + 1;
+	}
+
+	value = strtol(field, &end, 10);
+	if((end == field) || (value < 0) || (value > 16383)){
+		return false;
+	}
+	*angle_raw = (uint16_t)value;
+
+	return true;
+}
+
+int main( int argc, char **argv ){
+	mt6701_noise_t noise;
+	mt6701_noise_result_t result;
+	char line[128];
+	uint16_t angle_raw;
+	uint32_t max_count = 0;
+	double rate = 0.0;
+	FILE *in = stdin;
+	uint8_t i;
+
+	if((argc > 1) && (strcmp(argv[1], "-") != 0)){
+		in = fopen(argv[1], "r");
+		if(in == NULL){
+			fprintf(stderr, "Can't open %s\n", argv[1]);
+			return 1;
+		}
+	}
+	if(argc > 2){
+		rate = atof(argv[2]);
+	}
+
+	mt6701_noise_init(&noise);
+	while(fgets(line, sizeof(line), in) != NULL){
+		if(line_parse(line, &angle_raw)){
+			mt6701_noise_add(&noise, angle_raw);
+		}
+	}
+
+	if(mt6701_noise_result(&noise, &result) != MT6701_OK){
+		fprintf(stderr, "Not enough samples\n");
+		return 1;
+	}
+
+	printf("Samples:        %lu\n", (unsigned long)result.samples);
+	printf("Mean:           %.3f raw (%.4f deg)\n", result.mean, result.mean * 360.0 / 16384.0);
+	printf("Std deviation:  %.3f raw (%.5f deg)\n", result.sigma, result.sigma * 360.0 / 16384.0);
+	printf("Peak to peak:   %u raw\n", (unsigned)result.peak_to_peak);
+
+	printf("\nHistogram (offset from first sample, edge bins include outliers):\n");
+	for(i = 0; i < MT6701_NOISE_HIST_BINS; i++){
+		if(noise.histogram[i] > max_count){
+			max_count = noise.histogram[i];
+		}
+	}
+	for(i = 0; i < MT6701_NOISE_HIST_BINS; i++){
+		if(noise.histogram[i] == 0){
+			continue;
+		}
+		printf("%+4d %8lu ", i - MT6701_NOISE_HIST_BINS / 2, (unsigned long)noise.histogram[i]);
+		for(angle_raw = 0; angle_raw < (uint16_t)(noise.histogram[i] * 50 / max_count); angle_raw++){
+			putchar('#');
+		}
+		putchar('\n');
+	}
+
+	printf("\nAllan deviation:\n");
+	for(i = 0; i < result.adev_levels; i++){
+		printf("%6lu samples", (unsigned long)1 << i);
+		if(rate > 0.0){
+			printf(" (%10.6f s)", (double)((unsigned long)1 << i) / rate);
+		}
+		printf("  %.4f raw%s\n", result.adev[i], (i == result.best_level) ? "  <- min" : "");
+	}
+
+	printf("\nRecommended:\n");
+	printf("  hysteresis: %s\n", hyst_name(result.hysteresis));
+	if(result.iir_shift != 0){
+		printf("  mt6701_filter_add_iir(&filter, %u);\n", (unsigned)result.iir_shift);
+	}else{
+		printf("  IIR filter: not needed\n");
+	}
+	printf("  mt6701_filter_add_deadband(&filter, %u);\n", (unsigned)result.deadband);
+
+	return 0;
+}
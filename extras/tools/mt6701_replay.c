@@ -0,0 +1,169 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Replays recorded mt6701_trace through driver on PC: prints decoded samples as CSV,
+// reports driver time per read and transactions that don't match recorded session.
+// Build:
+//   cc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -I../../src/mt6701 mt6701_replay.c ../../src/mt6701/mt6701_trace.c ../../src/mt6701/mt6701.c -o mt6701_replay
+// Usage:
+//   mt6701_replay trace.bin [retries] > samples.csv
+// retries - I2C retries of recording firmware (default MT6701_I2C_RETRIES, same as Arduino wrapper),
+// so failed transaction with its retries replayed as one read.
+// Exit code 1 on mismatch, so can be used in regression scripts.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mt6701_trace.h"
+
+#define TRACE_MAX_ENTRIES	65535
+
+static void delay_stub( uint32_t ms ){
+	(void)ms;
+}
+
+static uint64_t time_ns( void ){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main( int argc, char **argv ){
+	mt6701_trace_entry_t *entries;
+	const mt6701_trace_entry_t *entry;
+	mt6701_handle_t handle = {0};
+	mt6701_replay_t replay;
+	FILE *in;
+	size_t count;
+	size_t i;
+	uint64_t elapsed = 0;
+	uint64_t start;
+	uint32_t time_us = 0;
+	uint32_t reads = 0;
+	uint32_t skipped = 0;
+	uint32_t failed = 0;
+	uint16_t angle_raw;
+	uint16_t pos;
+	mt6701_status_t field_status;
+	bool button_pushed;
+	bool track_loss;
+	uint8_t res;
+	int retries = MT6701_I2C_RETRIES;
+
+	if(argc < 2){
+		fprintf(stderr, "Usage: %s trace.bin [retries]\n", argv[0]);
+		return 2;
+	}
+	if(argc > 2){
+		retries = atoi(argv[2]);
+		if((retries < 0) || (retries > 255)){
+			fprintf(stderr, "Retries must be 0...255\n");
+			return 2;
+		}
+	}
+
+	in = fopen(argv[1], "rb");
+	if(in == NULL){
+		fprintf(stderr, "Can't open %s\n", argv[1]);
+		return 2;
+	}
+
+	entries = (mt6701_trace_entry_t*)malloc(TRACE_MAX_ENTRIES * sizeof(mt6701_trace_entry_t));
+	if(entries == NULL){
+		fclose(in);
+		return 2;
+	}
+	count = fread(entries, sizeof(mt6701_trace_entry_t), TRACE_MAX_ENTRIES, in);
+	fclose(in);
+
+	// Interface selected by recorded transactions
+	handle.interface = MT6701_INTERFACE_I2C;
+	for(i = 0; i < count; i++){
+		if(entries[i].type == MT6701_TRACE_SSI_READ){
+			handle.interface = MT6701_INTERFACE_SSI;
+			break;
+		}
+	}
+	handle.delay = delay_stub;
+
+	if(mt6701_replay_attach(&replay, &handle, entries, (uint16_t)count) != MT6701_OK){
+		fprintf(stderr, "Replay attach failed\n");
+		free(entries);
+		return 2;
+	}
+	// Driver consumes recorded retries same way as produced them, no backoff delay on PC
+	mt6701_i2c_retry_set(&handle, (uint8_t)retries, 0);
+
+	printf("time_us,angle_raw,field,button,track_loss,result\n");
+	while((entry = mt6701_replay_next(&replay)) != NULL){
+		time_us += (uint32_t)entry->dt[0] | ((uint32_t)entry->dt[1] << 8);
+
+		// Position reads replayed through driver, configuration transactions skipped
+		if((entry->type != MT6701_TRACE_SSI_READ) && !(((entry->type == MT6701_TRACE_I2C_READ) || (entry->type == MT6701_TRACE_I2C_BURST)) && (entry->reg == MT6701_REG_ANGLE6))){
+			fprintf(stderr, "skip: type %u reg 0x%02X data 0x%02X\n", entry->type, entry->reg, entry->data[0]);
+			mt6701_replay_skip(&replay);
+			skipped++;
+			continue;
+		}
+
+		field_status = MT6701_STATUS_NORM;
+		button_pushed = false;
+		track_loss = false;
+
+		pos = replay.pos;
+		start = time_ns();
+		res = mt6701_read_raw(&handle, &angle_raw, &field_status, &button_pushed, &track_loss);
+		elapsed += time_ns() - start;
+		reads++;
+
+		// Timestamp of last transaction of read
+		for(pos++; pos < replay.pos; pos++){
+			time_us += (uint32_t)entries[pos].dt[0] | ((uint32_t)entries[pos].dt[1] << 8);
+		}
+
+		if(res != MT6701_OK){
+			failed++;
+			printf("%lu,,,,,%u\n", (unsigned long)time_us, res);
+			if(replay.mismatches){
+				// Driver request sequence differs from recorded one, can't continue in sync
+				mt6701_replay_skip(&replay);
+			}
+			continue;
+		}
+		printf("%lu,%u,%u,%u,%u,0\n", (unsigned long)time_us, angle_raw, (unsigned)field_status, button_pushed ? 1u : 0u, track_loss ? 1u : 0u);
+	}
+
+	fprintf(stderr, "Entries: %lu, reads: %lu, failed: %lu, skipped: %lu, mismatches: %lu\n",
+		(unsigned long)count, (unsigned long)reads, (unsigned long)failed, (unsigned long)skipped, (unsigned long)replay.mismatches);
+	if(reads){
+		fprintf(stderr, "Driver time: %.1f ns per read\n", (double)elapsed / reads);
+	}
+
+	free(entries);
+	return replay.mismatches ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Latest sample slot test on host: writer thread publishes samples as fast as possible,
+// reader threads check that angle, status and timestamp of every copy belong to one sample.
+// Build:
+//   cc -std=c99 -O2 -pthread -D_XOPEN_SOURCE=700 -I../../src/mt6701 mt6701_slot_test.c ../../src/mt6701/mt6701_slot.c ../../src/mt6701/mt6701.c -o mt6701_slot_test
+// Usage:
+//   mt6701_slot_test [readers] [writes]
+// Exit code 1 if torn copy found.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "mt6701_slot.h"
+
+#define READERS_MAX		16
+
+typedef struct{
+	unsigned long reads;
+	unsigned long busy;
+	unsigned long torn;
+} reader_t;
+
+static mt6701_slot_t slot;
+static volatile int done;
+static unsigned long writes = 10000000;
+
+// Status and angle derived from timestamp, so mixed fields of two samples detected
+static void sample_make( uint32_t time_us, mt6701_sample_t *sample ){
+	sample->angle_raw = (uint16_t)((time_us * 2654435761u) >> 18);
+	sample->status = (uint8_t)((time_us ^ (time_us >> 8)) & 0x1F);
+}
+
+static void *writer_run( void *arg ){
+	mt6701_sample_t sample;
+	unsigned long i;
+
+	(void)arg;
+	for(i = 1; i <= writes; i++){
+		sample_make((uint32_t)i, &sample);
+		mt6701_slot_write(&slot, &sample, (uint32_t)i);
+	}
+	done = 1;
+
+	return NULL;
+}
+
+static void *reader_run( void *arg ){
+	reader_t *reader = (reader_t*)arg;
+	mt6701_sample_t sample;
+	mt6701_sample_t expected;
+	uint32_t time_us;
+
+	while(!done){
+		if(!mt6701_slot_read(&slot, &sample, &time_us, NULL)){
+			reader->busy++;
+			continue;
+		}
+		reader->reads++;
+		sample_make(time_us, &expected);
+		if((time_us != 0) && ((sample.angle_raw != expected.angle_raw) || (sample.status != expected.status))){
+			reader->torn++;
+		}
+	}
+
+	return NULL;
+}
+
+int main( int argc, char **argv ){
+	pthread_t writer;
+	pthread_t readers[READERS_MAX];
+	reader_t stats[READERS_MAX] = {{0}};
+	unsigned long reads = 0;
+	unsigned long busy = 0;
+	unsigned long torn = 0;
+	int count = 3;
+	int i;
+
+	if(argc > 1){
+		count = atoi(argv[1]);
+		if((count < 1) || (count > READERS_MAX)){
+			count = 3;
+		}
+	}
+	if(argc > 2){
+		writes = strtoul(argv[2], NULL, 10);
+	}
+
+	mt6701_slot_init(&slot);
+
+	for(i = 0; i < count; i++){
+		pthread_create(&readers[i], NULL, reader_run, &stats[i]);
+	}
+	pthread_create(&writer, NULL, writer_run, NULL);
+
+	pthread_join(writer, NULL);
+	for(i = 0; i < count; i++){
+		pthread_join(readers[i], NULL);
+		reads += stats[i].reads;
+		busy += stats[i].busy;
+		torn += stats[i].torn;
+	}
+
+	printf("Writes: %lu, readers: %d, reads: %lu, busy: %lu, torn: %lu\n", writes, count, reads, busy, torn);
+
+	return (torn != 0) ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Host decoder for mt6701_telemetry stream, prints samples as CSV.
+// Build:
+//   cc -std=c99 -O2 -I../../src/mt6701 mt6701_telemetry_csv.c ../../src/mt6701/mt6701_telemetry.c ../../src/mt6701/mt6701.c -o mt6701_telemetry_csv
+// Usage:
+//   mt6701_telemetry_csv [capture.bin]   (stdin if no file, e.g. cat /dev/ttyUSB0 | mt6701_telemetry_csv)
+
+#include <stdio.h>
+#include "mt6701_telemetry.h"
+
+static void sample_print( void *context, const mt6701_sample_t *sample, uint32_t time_us ){
+	FILE *out = (FILE*)context;
+
+	fprintf(out, "%lu,%u,%.4f,%u,%u,%u\n",
+		(unsigned long)time_us,
+		(unsigned)sample->angle_raw,
+		(double)sample->angle_raw * 360.0 / 16384.0,
+		(unsigned)(sample->status & MT6701_SAMPLE_FIELD_MASK),
+		(sample->status & MT6701_SAMPLE_BUTTON) ? 1u : 0u,
+		(sample->status & MT6701_SAMPLE_TRACK_LOSS) ? 1u : 0u);
+}
+
+int main( int argc, char **argv ){
+	mt6701_telemetry_decoder_t decoder;
+	uint8_t buf[256];
+	size_t len;
+	FILE *in = stdin;
+
+	if(argc > 1){
+		in = fopen(argv[1], "rb");
+		if(in == NULL){
+			fprintf(stderr, "Can't open %s\n", argv[1]);
+			return 1;
+		}
+	}
+
+	mt6701_telemetry_decoder_init(&decoder, sample_print, stdout);
+	printf("time_us,angle_raw,angle_deg,field,button,track_loss\n");
+
+	while((len = fread(buf, 1, sizeof(buf), in)) > 0){
+		mt6701_telemetry_decode(&decoder, buf, (uint32_t)len);
+	}
+
+	fprintf(stderr, "Frames: %lu, errors: %lu\n", (unsigned long)decoder.frames, (unsigned long)decoder.errors);
+
+	if(in != stdin){
+		fclose(in);
+	}
+	return 0;
+}
@@ -0,0 +1,193 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Multitask access test on host: several threads read one mock chip over shared mock bus
+// through separate handlers. Mock bus detects overlapped transactions, mock chip latches
+// angle on ANGLE6 read (as consistency check for ANGLE6/ANGLE0 pair).
+// Build:
+//   cc -std=c99 -O2 -pthread -D_XOPEN_SOURCE=700 -I../../src/mt6701 mt6701_thread_test.c ../../src/mt6701/mt6701.c -o mt6701_thread_test
+// Usage:
+//   mt6701_thread_test [threads] [reads per thread] [nolock]
+// Exit code 1 if overlapped transactions or torn readings found.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include "mt6701.h"
+
+#define THREADS_MAX		16
+
+typedef struct{
+	pthread_mutex_t guard;
+	volatile int busy;
+	unsigned long overlaps;
+	uint16_t angle;
+	uint16_t latched;
+} mock_bus_t;
+
+typedef struct{
+	mt6701_handle_t handle;
+	unsigned long reads;
+	unsigned long torn;
+	unsigned long errors;
+} worker_t;
+
+static mock_bus_t bus;
+static unsigned long reads_per_thread = 100000;
+
+// Angle with low 6 bits derived from high 8 bits, mixed halves of two angles detected
+static uint16_t mock_angle( uint16_t seed ){
+	uint16_t hi = seed & 0xFF;
+	return (uint16_t)((hi << 6) | ((hi * 37 + 11) & 0x3F));
+}
+
+static void mock_transaction_begin( void ){
+	pthread_mutex_lock(&bus.guard);
+	if(bus.busy){
+		bus.overlaps++;
+	}
+	bus.busy = 1;
+	pthread_mutex_unlock(&bus.guard);
+	sched_yield();
+}
+
+static void mock_transaction_end( void ){
+	bus.busy = 0;
+}
+
+static uint8_t mock_i2c_read( void *obj, uint8_t reg, uint8_t *data ){
+	(void)obj;
+	mock_transaction_begin();
+	if(reg == MT6701_REG_ANGLE6){
+		bus.latched = mock_angle(bus.angle++);
+		*data = (uint8_t)(bus.latched >> 6);
+	}else if(reg == MT6701_REG_ANGLE0){
+		*data = (uint8_t)((bus.latched & 0x3F) << MT6701_REG_ANGLE0_POS);
+	}else{
+		*data = 0;
+	}
+	mock_transaction_end();
+	return 0;
+}
+
+static uint8_t mock_i2c_write( void *obj, uint8_t reg, uint8_t data ){
+	(void)obj;
+	(void)reg;
+	(void)data;
+	mock_transaction_begin();
+	mock_transaction_end();
+	return 0;
+}
+
+static void mock_delay( uint32_t ms ){
+	(void)ms;
+}
+
+static void bus_lock( void *obj ){
+	pthread_mutex_lock((pthread_mutex_t*)obj);
+}
+
+static void bus_unlock( void *obj ){
+	pthread_mutex_unlock((pthread_mutex_t*)obj);
+}
+
+static void *worker_run( void *arg ){
+	worker_t *worker = (worker_t*)arg;
+	uint16_t angle_raw;
+	unsigned long i;
+
+	for(i = 0; i < reads_per_thread; i++){
+		if(mt6701_read_raw(&worker->handle, &angle_raw, NULL, NULL, NULL) != MT6701_OK){
+			worker->errors++;
+			continue;
+		}
+		worker->reads++;
+		if(angle_raw != mock_angle((uint16_t)(angle_raw >> 6))){
+			worker->torn++;
+		}
+	}
+
+	return NULL;
+}
+
+int main( int argc, char **argv ){
+	pthread_t threads[THREADS_MAX];
+	worker_t workers[THREADS_MAX];
+	pthread_mutexattr_t attr;
+	pthread_mutex_t lock;
+	unsigned long torn = 0;
+	unsigned long errors = 0;
+	int count = 4;
+	int use_lock = 1;
+	int i;
+
+	if(argc > 1){
+		count = atoi(argv[1]);
+		if((count < 1) || (count > THREADS_MAX)){
+			count = 4;
+		}
+	}
+	if(argc > 2){
+		reads_per_thread = strtoul(argv[2], NULL, 10);
+	}
+	if((argc > 3) && (strcmp(argv[3], "nolock") == 0)){
+		use_lock = 0;
+	}
+
+	pthread_mutex_init(&bus.guard, NULL);
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&lock, &attr);
+
+	for(i = 0; i < count; i++){
+		memset(&workers[i], 0, sizeof(worker_t));
+		workers[i].handle.i2c_read = mock_i2c_read;
+		workers[i].handle.i2c_write = mock_i2c_write;
+		workers[i].handle.delay = mock_delay;
+		mt6701_interface_set(&workers[i].handle, MT6701_INTERFACE_I2C);
+		if(use_lock){
+			mt6701_lock_set(&workers[i].handle, bus_lock, bus_unlock, &lock);
+		}
+		mt6701_init(&workers[i].handle);
+	}
+
+	for(i = 0; i < count; i++){
+		pthread_create(&threads[i], NULL, worker_run, &workers[i]);
+	}
+	for(i = 0; i < count; i++){
+		pthread_join(threads[i], NULL);
+		torn += workers[i].torn;
+		errors += workers[i].errors;
+	}
+
+	printf("Threads: %d, reads: %lu, lock: %s\n", count, (unsigned long)count * reads_per_thread, use_lock ? "yes" : "no");
+	printf("Overlapped transactions: %lu, torn readings: %lu, errors: %lu\n", bus.overlaps, torn, errors);
+
+	return ((bus.overlaps != 0) || (torn != 0) || (errors != 0)) ? 1 : 0;
+}
@@ -28,54 +28,196 @@ SOFTWARE.
 #include "MT6701.h"
 #include <SPI.h>
 
-uint8_t MT6701::ssi_read( uint8_t* data, uint8_t len ){
+// SSI tuning steps up to max 8MHz, SPI driver rounds clock down to nearest supported
+static const uint32_t mt6701_ssi_clocks[] = { 250000, 500000, 1000000, 2000000, 4000000, 8000000 };
+
+uint8_t MT6701::ssi_read( void *obj, uint8_t* data, uint8_t len ){
+	MT6701 *self = (MT6701*)obj;
 	if(len != 3){
 		return 1;
 	}
 	uint8_t tmp[3];
-	SPI.beginTransaction(SPISettings(MT6701_SSI_CLOCK, MSBFIRST, SPI_MODE1));
+	SPI.beginTransaction(SPISettings(self->handle.ssi_clock, MSBFIRST, SPI_MODE1));
+	digitalWrite(self->cs_pin, LOW);
 	tmp[0] = SPI.transfer(0xff);
 	tmp[1] = SPI.transfer(0xff);
 	tmp[2] = SPI.transfer(0xff);
+	digitalWrite(self->cs_pin, HIGH);
 	memcpy(data, &tmp, 3);
 	SPI.endTransaction();
 	return 0;
 }
 
+// Clock stored in handler by driver and applied on next transaction
+uint8_t MT6701::ssi_clock_set( void *obj, uint32_t clock ){
+	(void)obj;
+	(void)clock;
+	return 0;
+}
+
+struct MT6701BusClock {
+	void *bus;
+	uint32_t clock;
+};
+
+static MT6701BusClock mt6701_bus_clocks[MT6701_I2C_BUSES_MAX];
+
+/*!
+ *  @brief  Register clock requested for bus. Called from initialization only
+ *  @param  bus Bus object (Wire instance)
+ *  @param  clock Requested clock, Hz
+ *  @return Clock to set: slowest of all requests for this bus, requested clock if registry full
+ */
+uint32_t MT6701::busClockRequest( void *bus, uint32_t clock ){
+	uint8_t i;
+
+	for(i = 0; i < MT6701_I2C_BUSES_MAX; i++){
+		if(mt6701_bus_clocks[i].bus == bus){
+			if(clock < mt6701_bus_clocks[i].clock){
+				mt6701_bus_clocks[i].clock = clock;
+			}
+			return mt6701_bus_clocks[i].clock;
+		}
+	}
+	for(i = 0; i < MT6701_I2C_BUSES_MAX; i++){
+		if(mt6701_bus_clocks[i].bus == NULL){
+			mt6701_bus_clocks[i].bus = bus;
+			mt6701_bus_clocks[i].clock = clock;
+			break;
+		}
+	}
+	return clock;
+}
+
+/*!
+ *  @brief  Clock set for bus by busClockRequest()
+ *  @param  bus Bus object (Wire instance)
+ *  @return Clock, Hz, 0 if not set
+ */
+uint32_t MT6701::busClockGet( void *bus ){
+	uint8_t i;
+
+	for(i = 0; i < MT6701_I2C_BUSES_MAX; i++){
+		if(mt6701_bus_clocks[i].bus == bus){
+			return mt6701_bus_clocks[i].clock;
+		}
+	}
+	return 0;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+struct MT6701BusLock {
+	void *bus;
+	SemaphoreHandle_t mutex;
+};
+
+static MT6701BusLock mt6701_bus_locks[MT6701_BUS_LOCKS_MAX];
+static portMUX_TYPE mt6701_bus_locks_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/*!
+ *  @brief  Get recursive mutex of bus, created on first request
+ *  @param  bus Bus object (Wire instance)
+ *  @return Mutex handle, NULL if registry full
+ */
+void *MT6701::busLockGet( void *bus ){
+	SemaphoreHandle_t mutex;
+	SemaphoreHandle_t found = NULL;
+	uint8_t i;
+
+	// Created outside of critical section, deleted if bus already registered
+	mutex = xSemaphoreCreateRecursiveMutex();
+	if(mutex == NULL){
+		return NULL;
+	}
+
+	portENTER_CRITICAL(&mt6701_bus_locks_mux);
+	for(i = 0; i < MT6701_BUS_LOCKS_MAX; i++){
+		if(mt6701_bus_locks[i].bus == bus){
+			found = mt6701_bus_locks[i].mutex;
+			break;
+		}
+	}
+	if(found == NULL){
+		for(i = 0; i < MT6701_BUS_LOCKS_MAX; i++){
+			if(mt6701_bus_locks[i].bus == NULL){
+				mt6701_bus_locks[i].bus = bus;
+				mt6701_bus_locks[i].mutex = mutex;
+				found = mutex;
+				mutex = NULL;
+				break;
+			}
+		}
+	}
+	portEXIT_CRITICAL(&mt6701_bus_locks_mux);
+
+	if(mutex != NULL){
+		vSemaphoreDelete(mutex);
+	}
+	return (void *)found;
+}
+
+void MT6701::busLock( void *obj ){
+	if(obj != NULL){
+		xSemaphoreTakeRecursive((SemaphoreHandle_t)obj, portMAX_DELAY);
+	}
+}
+
+void MT6701::busUnlock( void *obj ){
+	if(obj != NULL){
+		xSemaphoreGiveRecursive((SemaphoreHandle_t)obj);
+	}
+}
+#endif
+
 static void mt6701_delay( uint32_t ms ){
 	delay(ms);
 }
 
+static void mt6701_delay_us( uint32_t us ){
+	delayMicroseconds(us);
+}
+
 /*!
  *  @brief  Instantiates a new MT6701 class
  */
 MT6701::MT6701( void ) {
 	handle = {0};
 	handle.delay = mt6701_delay;
+	handle.delay_us = mt6701_delay_us;
+	mt6701_i2c_retry_set(&handle, MT6701_I2C_RETRIES, MT6701_I2C_BACKOFF_US);
+	_i2c_ctx.sda_pin = -1;
+	_i2c_ctx.scl_pin = -1;
+	_i2c_ctx.clock_get = NULL;
+	watchdog = NULL;
 }
 
 /*!
  * @brief  Initialize MT6701 for work over ISS over SPI
  * @param  cs_pin CSN pin of MT6701
+ * @param  clock SSI clock, Hz, can be found later with ssiClockTune()
  */
-bool MT6701::initializeSSI( int cs_pin ){
+bool MT6701::initializeSSI( int cs_pin, uint32_t clock ){
 	uint8_t res;
 
 	res = mt6701_interface_set(&this->handle, MT6701_INTERFACE_SSI);
 	if(res != MT6701_OK){
 		return false;
 	}
-	
-	this->handle.ssi_read = this->ssi_read;
-	res = mt6701_init(&this->handle);
-	if(res != MT6701_OK){
-		return false;
-	}
 
 	this->cs_pin = cs_pin;
 	pinMode(this->cs_pin, OUTPUT);
 	digitalWrite(this->cs_pin, HIGH);
 
+	// CS driven inside callback, so every driver call (also tuning) makes complete frames
+	this->handle.ssi_object = this;
+	this->handle.ssi_read_obj = this->ssi_read;
+	this->handle.ssi_clock_set = this->ssi_clock_set;
+	this->handle.ssi_clock = clock;
+	res = mt6701_init(&this->handle);
+	if(res != MT6701_OK){
+		return false;
+	}
+
 	return true;
 }
 
@@ -84,18 +226,49 @@ bool MT6701::initializeSSI( int cs_pin ){
  *  @return Angle value of encoder position
  */
 float MT6701::angleRead( void ){
-	float angle = 0.0f;
-	
-	if(this->handle.interface == MT6701_INTERFACE_SSI){
-		digitalWrite(this->cs_pin, LOW);
+	mt6701_sample_t sample;
+
+	if(!this->sampleRead(&sample)){
+		return 0.0f;
 	}
+	return (float)sample.angle_raw * (360.0f/16384.0f);
+}
+
+/*!
+ *  @brief  Return raw position of encoder
+ *  @return Raw angle value of encoder position [0...16383]
+ */
+uint16_t MT6701::angleRawRead( void ){
+	mt6701_sample_t sample;
+
+	if(!this->sampleRead(&sample)){
+		return 0;
+	}
+	return sample.angle_raw;
+}
+
+/*!
+ *  @brief  Read raw position and status in one transaction (status only with SSI)
+ *  @param  sample Raw angle [0...16383] and MT6701_SAMPLE_x status bits
+ *  @return True on success
+ */
+bool MT6701::sampleRead( mt6701_sample_t *sample ){
+	uint8_t res;
 
-	mt6701_read(&this->handle, &angle, NULL, NULL, NULL);
+	res = mt6701_read_sample(&this->handle, sample);
 
-	if(this->handle.interface == MT6701_INTERFACE_SSI){
-		digitalWrite(this->cs_pin, HIGH);
+	if(this->watchdog != NULL){
+		mt6701_watchdog_update(this->watchdog, (res == MT6701_OK) ? sample : NULL);
 	}
-	return angle;
+	return res == MT6701_OK;
+}
+
+/*!
+ *  @brief  Attach watchdog, updated by every angle read without extra transactions
+ *  @param  watchdog Initialized watchdog, NULL to detach
+ */
+void MT6701::watchdogAttach( mt6701_watchdog_t *watchdog ){
+	this->watchdog = watchdog;
 }
 
 /*!
@@ -103,18 +276,96 @@ float MT6701::angleRead( void ){
  *  @return Field status
  */
 mt6701_status_t MT6701::fieldStatusRead( void ){
-	mt6701_status_t field_status = MT6701_STATUS_FIELD_ERROR;
+	mt6701_sample_t sample;
+
+	if(!this->sampleRead(&sample) || !(sample.status & MT6701_SAMPLE_STATUS_VALID)){
+		return MT6701_STATUS_FIELD_ERROR;
+	}
+	return (mt6701_status_t)(sample.status & MT6701_SAMPLE_FIELD_MASK);
+}
+
+/*!
+ *  @brief  Find fastest SSI clock with valid frames (CRC6, consistent angle) for this sensor and wiring.
+ *          Clocks 0.25...8 MHz tried, selected clock one step below first failed. Shaft can rotate slowly
+ *  @param  reads Frames checked on every clock
+ *  @return Selected clock, Hz, 0 if no clock works (previous clock kept)
+ */
+uint32_t MT6701::ssiClockTune( uint16_t reads ){
+	uint32_t clock;
 
-	if(this->handle.interface == MT6701_INTERFACE_SSI){
-		digitalWrite(this->cs_pin, LOW);
+	if(mt6701_ssi_clock_tune(&this->handle, mt6701_ssi_clocks, sizeof(mt6701_ssi_clocks) / sizeof(mt6701_ssi_clocks[0]), reads, &clock) != MT6701_OK){
+		return 0;
 	}
+	return clock;
+}
+
+/*!
+ *  @brief  Current SSI clock
+ *  @return Clock, Hz
+ */
+uint32_t MT6701::ssiClockGet( void ){
+	return this->handle.ssi_clock;
+}
+
+/*!
+ *  @brief  Check CRC6 of every SSI frame, reads with wrong CRC fail
+ *  @param  enable True - check
+ */
+void MT6701::ssiCrcCheckSet( bool enable ){
+	mt6701_ssi_crc_check_set(&this->handle, enable);
+}
+
+/*!
+ *  @brief  Set I2C retry policy
+ *  @param  retries Retries after failed transaction, 0 - disabled
+ *  @param  backoff_us First retry delay in us, doubled on every next retry
+ */
+void MT6701::i2cRetrySet( uint8_t retries, uint16_t backoff_us ){
+	mt6701_i2c_retry_set(&this->handle, retries, backoff_us);
+}
+
+/*!
+ *  @brief  Set I2C pins for stuck bus recovery, done automatically before retry
+ *  @param  sda_pin SDA pin of Wire bus, -1 - recovery disabled
+ *  @param  scl_pin SCL pin of Wire bus, -1 - recovery disabled
+ */
+void MT6701::i2cRecoveryPinsSet( int sda_pin, int scl_pin ){
+	this->_i2c_ctx.sda_pin = sda_pin;
+	this->_i2c_ctx.scl_pin = scl_pin;
+}
 
-	mt6701_read(&this->handle, NULL, &field_status, NULL, NULL);
+/*!
+ *  @brief  Actual I2C clock of encoder bus: reported by interface (getClock(), AVR hardware TWI registers)
+ *          or clock set in initializeI2C()
+ *  @return Clock, Hz, 0 if unknown
+ */
+uint32_t MT6701::i2cClockGet( void ){
+	uint32_t clock = 0;
 
-	if(this->handle.interface == MT6701_INTERFACE_SSI){
-		digitalWrite(this->cs_pin, HIGH);
+	if(this->_i2c_ctx.clock_get != NULL){
+		clock = this->_i2c_ctx.clock_get(this->_i2c_ctx.wire);
+	}
+#if defined(__AVR__) && defined(TWBR) && defined(TWSR)
+	// SCL = F_CPU / (16 + 2 * TWBR * 4^prescaler)
+	if((clock == 0) && (this->_i2c_ctx.wire == (void *)&Wire)){
+		clock = F_CPU / (16UL + 2UL * TWBR * (1UL << (2 * (TWSR & 0x03))));
 	}
-	return field_status;
+#endif
+	if(clock == 0){
+		clock = busClockGet(this->_i2c_ctx.wire);
+	}
+	return clock;
+}
+
+/*!
+ *  @brief  Recover I2C bus with SDA held low by slave (9 clocks and STOP). Nothing done if SDA high
+ *  @return True if SDA released or was not held
+ */
+bool MT6701::i2cBusRecover( void ){
+	if(this->handle.i2c_recover == NULL){
+		return false;
+	}
+	return this->handle.i2c_recover(this->handle.i2c_object) == 0;
 }
 
 /*!
@@ -185,6 +436,17 @@ void MT6701::offsetSet( float offset ){
 	mt6701_zero_set(&this->handle, offset);
 }
 
+/*!
+ *  @brief  Set current position as zero. Averages readings, writes new offset and verifies it
+ *  @param  samples Readings to average (1...4096)
+ *  @param  program True - save new offset to chip EEPROM after verification
+ *  @return True on success
+ */
+bool MT6701::offsetAuto( uint16_t samples, bool program ){
+	// 12 bit zero step is 4 raw units, plus noise margin
+	return mt6701_zero_auto(&this->handle, samples, 8, program, NULL) == MT6701_OK;
+}
+
 /*!
  *  @brief  Set direction of encoder
  *  @param  direction Direction of encoder. Possible values:
@@ -202,6 +464,44 @@ void MT6701::programmEEPROM( void ){
 	mt6701_programm_eeprom(&this->handle);
 }
 
+/*!
+ *  @brief  Read whole configuration in one burst
+ *  @param  profile Read configuration
+ *  @return True on success
+ */
+bool MT6701::profileRead( mt6701_profile_t *profile ){
+	return mt6701_profile_read(&this->handle, profile) == MT6701_OK;
+}
+
+/*!
+ *  @brief  Write changed configuration registers and verify by readback. I2C address is not changed.
+ *  @param  profile Configuration, e.g. deserialized with mt6701_profile_deserialize()
+ *  @param  program True - save to EEPROM after verification
+ *  @return True on success
+ */
+bool MT6701::profileApply( const mt6701_profile_t *profile, bool program ){
+	return mt6701_profile_apply(&this->handle, profile, program, NULL) == MT6701_OK;
+}
+
+/*!
+ *  @brief  Read all known registers (2 I2C transactions) and print decoded configuration as one line
+ *  @param  out Output, e.g. Serial
+ *  @return True on success
+ */
+bool MT6701::diagnosticPrint( Print &out ){
+	mt6701_diag_t diag;
+	char text[MT6701_DIAG_TEXT_SIZE];
+
+	if(mt6701_diag_read(&diag, &this->handle) != MT6701_OK){
+		return false;
+	}
+	if(mt6701_diag_format(&diag, text, sizeof(text)) == 0){
+		return false;
+	}
+	out.println(text);
+	return true;
+}
+
 /*!
  *  @brief  Change I2C address to alternate (0x46). Save to EEPROM with programmEEPROM().
  *  @return True on success
@@ -31,33 +31,74 @@ SOFTWARE.
 #include <Arduino.h>
 #include <Wire.h>
 #include "mt6701/mt6701.h"
+#include "mt6701/mt6701_watchdog.h"
+#include "mt6701/mt6701_profile.h"
+#include "mt6701/mt6701_diag.h"
+
+// Max I2C clock of MT6701 (Fast-mode Plus)
+#ifndef MT6701_I2C_CLOCK_MAX
+#define MT6701_I2C_CLOCK_MAX    1000000
+#endif
+
+// How many different Wire buses remember requested clock
+#ifndef MT6701_I2C_BUSES_MAX
+#define MT6701_I2C_BUSES_MAX    4
+#endif
+
+// How many different Wire buses can be locked (ESP32 only)
+#ifndef MT6701_BUS_LOCKS_MAX
+#define MT6701_BUS_LOCKS_MAX    4
+#endif
 
 #ifndef MT6701_SSI_CLOCK
 #define MT6701_SSI_CLOCK    1000000
 #endif
 
+template <uint8_t N>
+class MT6701Array;
+
 /*!
  *  @brief  Class that stores state and functions for MT6701
  */
 class MT6701 {
+	// Uses one instance as shared bus and retargets it to every encoder
+	template <uint8_t N>
+	friend class MT6701Array;
+
 public:
 	MT6701( void );
 	
 	/*!
 	 * @brief  Initialize MT6701 for work over I2C using any Wire-compatible interface
 	 * @tparam T The type of Wire interface (e.g., TwoWire, SoftWire)
-	 * @param  wire_interface Pointer to the Wire instance (e.g., &Wire, &Wire1)
+	 * @param  wire_interface Pointer to the Wire instance (e.g., &Wire, &Wire1), begin() must be called before
+	 * @param  address MT6701_DEFAULT_ADDRESS or MT6701_ALTERNATE_ADDRESS
+	 * @param  clock I2C clock, Hz (100000, 400000, 1000000), 0 - keep current. Encoders on one bus share
+	 *         slowest requested clock. Applied if interface has setClock(), check with i2cClockGet()
 	 */
 	template <typename T>
-	bool initializeI2C(T *wire_interface, uint8_t address = MT6701_DEFAULT_ADDRESS) {
+	bool initializeI2C(T *wire_interface, uint8_t address = MT6701_DEFAULT_ADDRESS, uint32_t clock = 0) {
 		uint8_t res;
 
 		_i2c_ctx.wire = (void *)wire_interface;
 		_i2c_ctx.address = address;
+		_i2c_ctx.clock_get = i2c_clock_template<T>;
+		if (clock != 0) {
+			if (clock > MT6701_I2C_CLOCK_MAX) {
+				clock = MT6701_I2C_CLOCK_MAX;
+			}
+			i2c_clock_set(wire_interface, busClockRequest((void *)wire_interface, clock), 0);
+		}
 
 		this->handle.i2c_object = &_i2c_ctx;
 		this->handle.i2c_read = i2c_read_template<T>;
 		this->handle.i2c_write = i2c_write_template<T>;
+		this->handle.i2c_read_burst = i2c_read_burst_template<T>;
+		this->handle.i2c_recover = i2c_recover_template<T>;
+#if defined(ARDUINO_ARCH_ESP32)
+		// Handlers on same Wire bus share one recursive mutex, so can be used from different tasks
+		mt6701_lock_set(&this->handle, busLock, busUnlock, busLockGet((void *)wire_interface));
+#endif
 
 		res = mt6701_interface_set(&this->handle, MT6701_INTERFACE_I2C);
 		if(res != MT6701_OK){
@@ -79,15 +120,78 @@ public:
 		return this->initializeI2C<TwoWire>(&Wire, MT6701_DEFAULT_ADDRESS);
 	}
 
-	bool initializeSSI( int cs_pin );
+	/*!
+	 * @brief  Find MT6701 on default and alternate address of every bus, verify and initialize found encoders
+	 * @tparam T The type of Wire interface (e.g., TwoWire, SoftWire)
+	 * @param  buses Wire buses (e.g., { &Wire, &Wire1 })
+	 * @param  bus_count Buses count (1...16)
+	 * @param  encoders 2 encoders per bus: [bus * 2] - default address, [bus * 2 + 1] - alternate address
+	 * @param  configure Called for every found encoder, can be NULL. Return false to mark encoder as failed
+	 * @param  program Save configuration to EEPROM, encoders of one bus programmed with one delay
+	 * @param  clock I2C clock, Hz, 0 - keep current (see initializeI2C())
+	 * @return Bit mask of found and configured encoders, bit index same as encoders array index
+	 */
+	template <typename T>
+	static uint32_t discover(T *const *buses, uint8_t bus_count, MT6701 *encoders, bool (*configure)(MT6701 &encoder) = NULL, bool program = false, uint32_t clock = 0) {
+		static const uint8_t addresses[2] = { MT6701_DEFAULT_ADDRESS, MT6701_ALTERNATE_ADDRESS };
+		uint32_t found = 0;
+		uint8_t bus_found;
+		uint8_t bus;
+		uint8_t i;
+
+		if (bus_count > 16) {
+			bus_count = 16;
+		}
+
+		for (bus = 0; bus < bus_count; bus++) {
+			bus_found = 0;
+			for (i = 0; i < 2; i++) {
+				MT6701 &encoder = encoders[bus * 2 + i];
+				if (!encoder.initializeI2C<T>(buses[bus], addresses[i], clock)) {
+					continue;
+				}
+				if ((mt6701_probe(&encoder.handle, addresses[i]) != MT6701_OK) ||
+				    ((configure != NULL) && !configure(encoder))) {
+					encoder.handle.initialized = false;
+					continue;
+				}
+				bus_found |= (uint8_t)(1 << i);
+			}
+
+			if (program && (bus_found != 0)) {
+				for (i = 0; i < 2; i++) {
+					if ((bus_found & (1 << i)) && (mt6701_programm_eeprom_start(&encoders[bus * 2 + i].handle) != MT6701_OK)) {
+						bus_found &= (uint8_t)~(1 << i);
+					}
+				}
+				delay(MT6701_EEPROM_PROGRAM_MS);
+			}
+
+			found |= (uint32_t)bus_found << (bus * 2);
+		}
+
+		return found;
+	}
+
+	bool initializeSSI( int cs_pin, uint32_t clock = MT6701_SSI_CLOCK );
 
 	// SPI & I2C functions
 	float angleRead( void );
+	uint16_t angleRawRead( void );
+	bool sampleRead( mt6701_sample_t *sample );
+	void watchdogAttach( mt6701_watchdog_t *watchdog );
 
 	// SPI only functions
 	mt6701_status_t fieldStatusRead( void );
+	uint32_t ssiClockTune( uint16_t reads = 256 );
+	uint32_t ssiClockGet( void );
+	void ssiCrcCheckSet( bool enable );
 
 	// I2C only functions
+	void i2cRetrySet( uint8_t retries, uint16_t backoff_us = MT6701_I2C_BACKOFF_US );
+	void i2cRecoveryPinsSet( int sda_pin, int scl_pin );
+	uint32_t i2cClockGet( void );
+	bool i2cBusRecover( void );
 	void uvwModeSet( uint8_t pole_pairs );
 	void abzModeSet( uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width = MT6701_PULSE_WIDTH_180, mt6701_hyst_t hysteresis = MT6701_HYST_1 );
 	void nanbnzEnable( bool nanbnz_enable ); // Only for QFN version
@@ -96,39 +200,145 @@ public:
 	void pwmModeSet( mt6701_pwm_freq_t frequency = MT6701_PWM_FREQ_497_2, mt6701_pwm_pol_t polarity = MT6701_PWM_POL_HIGH );
 	// General tracking options
 	void offsetSet( float offset );
+	bool offsetAuto( uint16_t samples = 64, bool program = false );
 	void directionSet( mt6701_direction_t direction );
 	// Save settings as default
 	void programmEEPROM( void );
+	// Whole configuration at once
+	bool profileRead( mt6701_profile_t *profile );
+	bool profileApply( const mt6701_profile_t *profile, bool program = false );
+	// Register dump decoded to one line
+	bool diagnosticPrint( Print &out );
 	// Change I2C address
 	bool i2cAddressChangeToAlternate( void );
 	bool i2cAddressChangeToDefault( void );
 
+	// C driver handler, for modules working on top of driver (trace, etc.)
+	mt6701_handle_t *driver( void ) { return &this->handle; }
+
 private:
 	int cs_pin;
 	mt6701_handle_t handle;
+	mt6701_watchdog_t *watchdog;
 
 	struct I2CContext {
 		void *wire;
 		uint8_t address;
+		int sda_pin;
+		int scl_pin;
+		uint32_t (*clock_get)( void *wire );	// Clock reported by interface, 0 if not supported
 	};
 	I2CContext _i2c_ctx;
 
-	// Internal c function for driver
-	static uint8_t ssi_read( uint8_t* data, uint8_t len );
+	// Internal c function for driver, obj is MT6701 instance
+	static uint8_t ssi_read( void *obj, uint8_t* data, uint8_t len );
+	static uint8_t ssi_clock_set( void *obj, uint32_t clock );
+
+	// Per bus requested clock registry
+	static uint32_t busClockRequest( void *bus, uint32_t clock );
+	static uint32_t busClockGet( void *bus );
+
+	// setClock()/getClock() used only if interface has them
+	template <typename U>
+	static auto i2c_clock_set(U *wire, uint32_t clock, int) -> decltype(wire->setClock(clock), bool()) {
+		wire->setClock(clock);
+		return true;
+	}
+
+	template <typename U>
+	static bool i2c_clock_set(U *, uint32_t, long) {
+		return false;
+	}
+
+	template <typename U>
+	static auto i2c_clock_read(U *wire, int) -> decltype((uint32_t)wire->getClock()) {
+		return (uint32_t)wire->getClock();
+	}
+
+	template <typename U>
+	static uint32_t i2c_clock_read(U *, long) {
+		return 0;
+	}
+
+	// end()/begin() used only if interface has them (software I2C may have neither)
+	template <typename U>
+	static auto i2c_end(U *wire, int) -> decltype(wire->end(), bool()) {
+		wire->end();
+		return true;
+	}
+
+	template <typename U>
+	static bool i2c_end(U *, long) {
+		return false;
+	}
+
+	template <typename U>
+	static auto i2c_begin(U *wire, int) -> decltype(wire->begin(), bool()) {
+		wire->begin();
+		return true;
+	}
+
+	template <typename U>
+	static bool i2c_begin(U *, long) {
+		return false;
+	}
+
+	template <typename T>
+	static uint32_t i2c_clock_template(void *wire) {
+		return i2c_clock_read((T*)wire, 0);
+	}
+
+#if defined(ARDUINO_ARCH_ESP32)
+	// Per bus recursive mutex registry
+	static void *busLockGet( void *bus );
+	static void busLock( void *obj );
+	static void busUnlock( void *obj );
+#endif
 
 	// Template wrappers for I2C read/write to support any Wire-like class
+	// Return endTransmission() codes (1...5), or 4 if no data received
 	template <typename T>
 	static uint8_t i2c_read_template(void *obj, uint8_t reg, uint8_t *data) {
 		I2CContext *ctx = (I2CContext*)obj;
 		T *wire = (T*)ctx->wire;
+		uint8_t res;
 		wire->beginTransmission(ctx->address);
 		wire->write(reg);
-		wire->endTransmission(false);
-		wire->requestFrom(ctx->address, (uint8_t)1);
+		res = wire->endTransmission(false);
+		if (res != 0) {
+			return res;
+		}
+		if (wire->requestFrom(ctx->address, (uint8_t)1) != 1) {
+			return 4;
+		}
 		if (wire->available()) {
 			*data = wire->read();
 		} else {
-			return 1;
+			return 4;
+		}
+		return 0;
+	}
+
+	template <typename T>
+	static uint8_t i2c_read_burst_template(void *obj, uint8_t reg, uint8_t *data, uint8_t len) {
+		I2CContext *ctx = (I2CContext*)obj;
+		T *wire = (T*)ctx->wire;
+		uint8_t res;
+		uint8_t i;
+		wire->beginTransmission(ctx->address);
+		wire->write(reg);
+		res = wire->endTransmission(false);
+		if (res != 0) {
+			return res;
+		}
+		if (wire->requestFrom(ctx->address, len) != len) {
+			return 4;
+		}
+		for (i = 0; i < len; i++) {
+			if (!wire->available()) {
+				return 4;
+			}
+			data[i] = wire->read();
 		}
 		return 0;
 	}
@@ -140,8 +350,48 @@ private:
 		wire->beginTransmission(ctx->address);
 		wire->write(reg);
 		wire->write(data);
-		wire->endTransmission();
-		return 0;
+		return wire->endTransmission();
+	}
+
+	// Release SDA held low by slave: up to 9 SCL pulses and STOP, then restart bus.
+	// Bus left untouched if SDA already high (failure not caused by stuck slave).
+	// Pins driven as open drain, works only if pins set with i2cRecoveryPinsSet
+	template <typename T>
+	static uint8_t i2c_recover_template(void *obj) {
+		I2CContext *ctx = (I2CContext*)obj;
+		T *wire = (T*)ctx->wire;
+		uint8_t i;
+		bool released;
+		if ((ctx->sda_pin < 0) || (ctx->scl_pin < 0)) {
+			return 1;
+		}
+		if (digitalRead(ctx->sda_pin) != LOW) {
+			return 0;
+		}
+		i2c_end(wire, 0);
+		pinMode(ctx->sda_pin, INPUT_PULLUP);
+		pinMode(ctx->scl_pin, INPUT_PULLUP);
+		delayMicroseconds(5);
+		for (i = 0; (i < 9) && (digitalRead(ctx->sda_pin) == LOW); i++) {
+			digitalWrite(ctx->scl_pin, LOW);
+			pinMode(ctx->scl_pin, OUTPUT);
+			delayMicroseconds(5);
+			pinMode(ctx->scl_pin, INPUT_PULLUP);
+			delayMicroseconds(5);
+		}
+		// STOP: SDA rises while SCL high
+		digitalWrite(ctx->sda_pin, LOW);
+		pinMode(ctx->sda_pin, OUTPUT);
+		delayMicroseconds(5);
+		pinMode(ctx->sda_pin, INPUT_PULLUP);
+		delayMicroseconds(5);
+		released = (digitalRead(ctx->sda_pin) == HIGH);
+		i2c_begin(wire, 0);
+		// begin() restores default clock
+		if (busClockGet(ctx->wire) != 0) {
+			i2c_clock_set(wire, busClockGet(ctx->wire), 0);
+		}
+		return released ? 0 : 1;
 	}
 };
 
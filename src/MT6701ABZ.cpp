@@ -0,0 +1,469 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MT6701ABZ.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "driver/pcnt.h"
+#endif
+
+#if MT6701_ABZ_MAX_INSTANCES > 4
+#error "MT6701_ABZ_MAX_INSTANCES must be 4 or less"
+#endif
+
+MT6701ABZ *MT6701ABZ::instances[MT6701_ABZ_MAX_INSTANCES];
+
+void (*const MT6701ABZ::isr_ab_table[MT6701_ABZ_MAX_INSTANCES])( void ) = {
+	isr_ab<0>,
+#if MT6701_ABZ_MAX_INSTANCES > 1
+	isr_ab<1>,
+#endif
+#if MT6701_ABZ_MAX_INSTANCES > 2
+	isr_ab<2>,
+#endif
+#if MT6701_ABZ_MAX_INSTANCES > 3
+	isr_ab<3>,
+#endif
+};
+
+void (*const MT6701ABZ::isr_z_table[MT6701_ABZ_MAX_INSTANCES])( void ) = {
+	isr_z<0>,
+#if MT6701_ABZ_MAX_INSTANCES > 1
+	isr_z<1>,
+#endif
+#if MT6701_ABZ_MAX_INSTANCES > 2
+	isr_z<2>,
+#endif
+#if MT6701_ABZ_MAX_INSTANCES > 3
+	isr_z<3>,
+#endif
+};
+
+/*!
+ *  @brief  Instantiates a new MT6701ABZ class
+ */
+MT6701ABZ::MT6701ABZ( void ) {
+	this->backend = BACKEND_NONE;
+	this->slot = -1;
+	this->pin_z = -1;
+#if defined(ARDUINO_ARCH_ESP32)
+	portMUX_INITIALIZE(&this->mux);
+#endif
+	mt6701_abz_init(&this->abz, 1024, MT6701_PULSE_WIDTH_180);
+}
+
+bool MT6701_ISR_ATTR MT6701ABZ::read_a( void ){
+#if defined(portInputRegister)
+	return (*this->reg_a & this->mask_a) != 0;
+#else
+	return digitalRead(this->pin_a) == HIGH;
+#endif
+}
+
+bool MT6701_ISR_ATTR MT6701ABZ::read_b( void ){
+#if defined(portInputRegister)
+	return (*this->reg_b & this->mask_b) != 0;
+#else
+	return digitalRead(this->pin_b) == HIGH;
+#endif
+}
+
+bool MT6701_ISR_ATTR MT6701ABZ::read_z( void ){
+	if(this->pin_z < 0){
+		return false;
+	}
+#if defined(portInputRegister)
+	return (*this->reg_z & this->mask_z) != 0;
+#else
+	return digitalRead(this->pin_z) == HIGH;
+#endif
+}
+
+void MT6701_ISR_ATTR MT6701ABZ::handle_ab( void ){
+	bool a = this->read_a();
+	bool b = this->read_b();
+
+	MT6701_LOCK_ISR(&this->mux);
+	mt6701_abz_edge(&this->abz, a, b);
+	MT6701_UNLOCK_ISR(&this->mux);
+}
+
+void MT6701_ISR_ATTR MT6701ABZ::handle_z( void ){
+	bool z = this->read_z();
+
+	MT6701_LOCK_ISR(&this->mux);
+#if defined(ARDUINO_ARCH_ESP32)
+	// Index snaps count, so hardware counter must be fetched first
+	if(this->backend == BACKEND_COUNTER){
+		this->counter_sync();
+	}
+#endif
+	mt6701_abz_index(&this->abz, z);
+	MT6701_UNLOCK_ISR(&this->mux);
+}
+
+bool MT6701ABZ::pins_init( uint8_t pin_a, uint8_t pin_b, int pin_z, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width ){
+	if(this->backend != BACKEND_NONE){
+		this->end();
+	}
+
+	if(mt6701_abz_init(&this->abz, pulses_per_round, z_pulse_width) != MT6701_OK){
+		return false;
+	}
+
+	this->pin_a = pin_a;
+	this->pin_b = pin_b;
+	this->pin_z = pin_z;
+
+	pinMode(pin_a, INPUT);
+	pinMode(pin_b, INPUT);
+#if defined(portInputRegister)
+	this->reg_a = (volatile mt6701_port_t *)portInputRegister(digitalPinToPort(pin_a));
+	this->reg_b = (volatile mt6701_port_t *)portInputRegister(digitalPinToPort(pin_b));
+	this->mask_a = (mt6701_port_t)digitalPinToBitMask(pin_a);
+	this->mask_b = (mt6701_port_t)digitalPinToBitMask(pin_b);
+#endif
+	if(pin_z >= 0){
+		pinMode(pin_z, INPUT);
+#if defined(portInputRegister)
+		this->reg_z = (volatile mt6701_port_t *)portInputRegister(digitalPinToPort(pin_z));
+		this->mask_z = (mt6701_port_t)digitalPinToBitMask(pin_z);
+#endif
+	}
+
+	mt6701_abz_state_set(&this->abz, this->read_a(), this->read_b(), this->read_z());
+
+	return true;
+}
+
+bool MT6701ABZ::slot_take( void ){
+	for(uint8_t i = 0; i < MT6701_ABZ_MAX_INSTANCES; i++){
+		if(instances[i] == NULL){
+			instances[i] = this;
+			this->slot = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+/*!
+ *  @brief  Start decoding with pin change interrupts, every A/B edge handled in ISR
+ *  @param  pin_a Pin connected to A output
+ *  @param  pin_b Pin connected to B output
+ *  @param  pin_z Pin connected to Z output, -1 if not used
+ *  @param  pulses_per_round Pulses per round, same as in abzModeSet (1...1024)
+ *  @param  z_pulse_width Z pulse width, same as in abzModeSet
+ *  @return True on success
+ */
+bool MT6701ABZ::beginInterrupt( uint8_t pin_a, uint8_t pin_b, int pin_z, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width ){
+	if(!this->pins_init(pin_a, pin_b, pin_z, pulses_per_round, z_pulse_width)){
+		return false;
+	}
+
+	if(digitalPinToInterrupt(pin_a) == NOT_AN_INTERRUPT || digitalPinToInterrupt(pin_b) == NOT_AN_INTERRUPT){
+		return false;
+	}
+	if(pin_z >= 0 && digitalPinToInterrupt(pin_z) == NOT_AN_INTERRUPT){
+		return false;
+	}
+
+	if(!this->slot_take()){
+		return false;
+	}
+
+	this->backend = BACKEND_INTERRUPT;
+	attachInterrupt(digitalPinToInterrupt(pin_a), isr_ab_table[this->slot], CHANGE);
+	attachInterrupt(digitalPinToInterrupt(pin_b), isr_ab_table[this->slot], CHANGE);
+	if(pin_z >= 0){
+		attachInterrupt(digitalPinToInterrupt(pin_z), isr_z_table[this->slot], CHANGE);
+	}
+
+	return true;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+// PCNT counter resets to 0 when reaches +-limit
+#define MT6701_ABZ_PCNT_LIMIT		32767
+
+void MT6701_ISR_ATTR MT6701ABZ::counter_isr( void *arg ){
+	MT6701ABZ *self = (MT6701ABZ*)arg;
+	uint32_t status = 0;
+
+	pcnt_get_event_status((pcnt_unit_t)self->unit, &status);
+	portENTER_CRITICAL_ISR(&self->mux);
+	// Reset may be already applied by counter_sync between limit event and this ISR
+	if(status & PCNT_EVT_H_LIM){
+		if(self->hw_early > 0){
+			self->hw_early = 0;
+		}else{
+			self->hw_overflow += MT6701_ABZ_PCNT_LIMIT;
+			self->hw_raw -= MT6701_ABZ_PCNT_LIMIT;
+		}
+	}else if(status & PCNT_EVT_L_LIM){
+		if(self->hw_early < 0){
+			self->hw_early = 0;
+		}else{
+			self->hw_overflow -= MT6701_ABZ_PCNT_LIMIT;
+			self->hw_raw += MT6701_ABZ_PCNT_LIMIT;
+		}
+	}
+	self->counter_sync();
+	portEXIT_CRITICAL_ISR(&self->mux);
+}
+
+// Feed hardware counter to decoder, caller must hold mux.
+// Jump over half of range since last sync means counter reset, which ISR not yet handled
+void MT6701_ISR_ATTR MT6701ABZ::counter_sync( void ){
+	int16_t value = 0;
+	int32_t delta;
+
+	pcnt_get_counter_value((pcnt_unit_t)this->unit, &value);
+	delta = (int32_t)value - this->hw_raw;
+	if(this->hw_early == 0){
+		if(delta < -(MT6701_ABZ_PCNT_LIMIT / 2)){
+			this->hw_overflow += MT6701_ABZ_PCNT_LIMIT;
+			this->hw_early = 1;
+		}else if(delta > (MT6701_ABZ_PCNT_LIMIT / 2)){
+			this->hw_overflow -= MT6701_ABZ_PCNT_LIMIT;
+			this->hw_early = -1;
+		}
+	}
+	this->hw_raw = value;
+	mt6701_abz_counter_update(&this->abz, (uint16_t)(this->hw_overflow + value));
+}
+#endif
+
+/*!
+ *  @brief  Start decoding with hardware counter (ESP32 PCNT), CPU not used per edge.
+ *          Z still handled with pin interrupt.
+ *  @param  pin_a Pin connected to A output
+ *  @param  pin_b Pin connected to B output
+ *  @param  pin_z Pin connected to Z output, -1 if not used
+ *  @param  pulses_per_round Pulses per round, same as in abzModeSet (1...1024)
+ *  @param  z_pulse_width Z pulse width, same as in abzModeSet
+ *  @return True on success, false if platform has no supported counter
+ */
+bool MT6701ABZ::beginCounter( uint8_t pin_a, uint8_t pin_b, int pin_z, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width ){
+#if defined(ARDUINO_ARCH_ESP32)
+	static bool isr_installed = false;
+	static uint8_t units_used = 0;
+	pcnt_config_t config = {};
+
+	if(!this->pins_init(pin_a, pin_b, pin_z, pulses_per_round, z_pulse_width)){
+		return false;
+	}
+
+	if(units_used >= PCNT_UNIT_MAX){
+		return false;
+	}
+	this->unit = units_used++;
+	this->hw_overflow = 0;
+	this->hw_raw = 0;
+	this->hw_early = 0;
+
+	// Full x4 decoding, A leads B - count up
+	config.unit = (pcnt_unit_t)this->unit;
+	config.counter_h_lim = MT6701_ABZ_PCNT_LIMIT;
+	config.counter_l_lim = -MT6701_ABZ_PCNT_LIMIT;
+
+	config.channel = PCNT_CHANNEL_0;
+	config.pulse_gpio_num = pin_a;
+	config.ctrl_gpio_num = pin_b;
+	config.pos_mode = PCNT_COUNT_DEC;
+	config.neg_mode = PCNT_COUNT_INC;
+	config.lctrl_mode = PCNT_MODE_REVERSE;
+	config.hctrl_mode = PCNT_MODE_KEEP;
+	if(pcnt_unit_config(&config) != ESP_OK){
+		return false;
+	}
+
+	config.channel = PCNT_CHANNEL_1;
+	config.pulse_gpio_num = pin_b;
+	config.ctrl_gpio_num = pin_a;
+	config.pos_mode = PCNT_COUNT_INC;
+	config.neg_mode = PCNT_COUNT_DEC;
+	if(pcnt_unit_config(&config) != ESP_OK){
+		return false;
+	}
+
+	pcnt_counter_pause(config.unit);
+	pcnt_counter_clear(config.unit);
+	pcnt_event_enable(config.unit, PCNT_EVT_H_LIM);
+	pcnt_event_enable(config.unit, PCNT_EVT_L_LIM);
+	if(!isr_installed){
+		pcnt_isr_service_install(0);
+		isr_installed = true;
+	}
+	pcnt_isr_handler_add(config.unit, counter_isr, this);
+	pcnt_counter_resume(config.unit);
+
+	this->backend = BACKEND_COUNTER;
+
+	if(pin_z >= 0){
+		if(digitalPinToInterrupt(pin_z) == NOT_AN_INTERRUPT || !this->slot_take()){
+			return false;
+		}
+		attachInterrupt(digitalPinToInterrupt(pin_z), isr_z_table[this->slot], CHANGE);
+	}
+
+	return true;
+#else
+	(void)pin_a;
+	(void)pin_b;
+	(void)pin_z;
+	(void)pulses_per_round;
+	(void)z_pulse_width;
+	return false;
+#endif
+}
+
+/*!
+ *  @brief  Stop decoding and release interrupts
+ */
+void MT6701ABZ::end( void ){
+	if(this->backend == BACKEND_INTERRUPT){
+		detachInterrupt(digitalPinToInterrupt(this->pin_a));
+		detachInterrupt(digitalPinToInterrupt(this->pin_b));
+	}
+#if defined(ARDUINO_ARCH_ESP32)
+	if(this->backend == BACKEND_COUNTER){
+		pcnt_counter_pause((pcnt_unit_t)this->unit);
+		pcnt_isr_handler_remove((pcnt_unit_t)this->unit);
+	}
+#endif
+	if(this->slot >= 0){
+		if(this->pin_z >= 0){
+			detachInterrupt(digitalPinToInterrupt(this->pin_z));
+		}
+		instances[this->slot] = NULL;
+		this->slot = -1;
+	}
+	this->backend = BACKEND_NONE;
+}
+
+/*!
+ *  @brief  Fetch hardware counter value. Only needed with counter backend,
+ *          read functions call it automatically. Must run at least once per 16383 counts
+ */
+void MT6701ABZ::update( void ){
+#if defined(ARDUINO_ARCH_ESP32)
+	if(this->backend != BACKEND_COUNTER){
+		return;
+	}
+
+	MT6701_LOCK(&this->mux);
+	this->counter_sync();
+	MT6701_UNLOCK(&this->mux);
+#endif
+}
+
+/*!
+ *  @brief  Return count of quadrature edges, 4 counts per pulse
+ *  @return Count value
+ */
+int32_t MT6701ABZ::countRead( void ){
+	int32_t count;
+
+	this->update();
+	MT6701_LOCK(&this->mux);
+	count = this->abz.count;
+	MT6701_UNLOCK(&this->mux);
+
+	return count;
+}
+
+/*!
+ *  @brief  Return full turns count
+ *  @return Turns, negative when rotated backward from start
+ */
+int32_t MT6701ABZ::turnsRead( void ){
+	return mt6701_abz_turns(&this->abz, this->countRead());
+}
+
+/*!
+ *  @brief  Return position inside turn in raw sensor units
+ *  @return Raw angle [0...16383], absolute only after first index
+ */
+uint16_t MT6701ABZ::angleRawRead( void ){
+	return mt6701_abz_angle_raw(&this->abz, this->countRead());
+}
+
+/*!
+ *  @brief  Return position inside turn
+ *  @return Angle [0...360.0), absolute only after first index
+ */
+float MT6701ABZ::angleRead( void ){
+	return (float)this->angleRawRead() * (360.0f/16384.0f);
+}
+
+/*!
+ *  @brief  Check if Z index was passed at least once
+ *  @return True if position is absolute
+ */
+bool MT6701ABZ::indexed( void ){
+	return this->abz.indexed;
+}
+
+/*!
+ *  @brief  Return count correction applied on last index, should be 0 when no edges lost
+ *  @return Counts error
+ */
+int32_t MT6701ABZ::indexErrorRead( void ){
+	int32_t error;
+
+	MT6701_LOCK(&this->mux);
+	error = this->abz.index_error;
+	MT6701_UNLOCK(&this->mux);
+
+	return error;
+}
+
+/*!
+ *  @brief  Return count of illegal A/B transitions (both lines changed between ISR calls)
+ *  @return Errors count
+ */
+uint16_t MT6701ABZ::errorsRead( void ){
+	uint16_t errors;
+
+	MT6701_LOCK(&this->mux);
+	errors = this->abz.errors;
+	MT6701_UNLOCK(&this->mux);
+
+	return errors;
+}
+
+/*!
+ *  @brief  Set count value
+ *  @param  count New count value
+ */
+void MT6701ABZ::countSet( int32_t count ){
+	this->update();
+	MT6701_LOCK(&this->mux);
+	this->abz.count = count;
+	MT6701_UNLOCK(&this->mux);
+}
@@ -0,0 +1,123 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ABZ_ARDUINO_WRAPPER_H__
+#define MT6701_ABZ_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+#include "MT6701Lock.h"
+#include "mt6701/mt6701_abz.h"
+
+// How many decoders with pin change backend can work at same time
+#ifndef MT6701_ABZ_MAX_INSTANCES
+#define MT6701_ABZ_MAX_INSTANCES    2
+#endif
+
+#if defined(portInputRegister)
+#if defined(__AVR__)
+typedef uint8_t mt6701_port_t;
+#else
+typedef uint32_t mt6701_port_t;
+#endif
+#endif
+
+/*!
+ *  @brief  Quadrature decoder for MT6701 ABZ output
+ */
+class MT6701ABZ {
+public:
+	MT6701ABZ( void );
+
+	bool beginInterrupt( uint8_t pin_a, uint8_t pin_b, int pin_z = -1, uint16_t pulses_per_round = 1024, mt6701_pulse_width_t z_pulse_width = MT6701_PULSE_WIDTH_180 );
+	bool beginCounter( uint8_t pin_a, uint8_t pin_b, int pin_z = -1, uint16_t pulses_per_round = 1024, mt6701_pulse_width_t z_pulse_width = MT6701_PULSE_WIDTH_180 );
+	void end( void );
+
+	// Must be called at least once per 16383 counts with counter backend
+	void update( void );
+
+	int32_t countRead( void );
+	int32_t turnsRead( void );
+	uint16_t angleRawRead( void );
+	float angleRead( void );
+	bool indexed( void );
+	int32_t indexErrorRead( void );
+	uint16_t errorsRead( void );
+	void countSet( int32_t count );
+
+	mt6701_abz_t *decoder( void ) { return &this->abz; }
+
+private:
+	enum Backend {
+		BACKEND_NONE,
+		BACKEND_INTERRUPT,
+		BACKEND_COUNTER,
+	};
+
+	mt6701_abz_t abz;
+	Backend backend;
+	int8_t slot;
+	uint8_t pin_a;
+	uint8_t pin_b;
+	int pin_z;
+#if defined(portInputRegister)
+	volatile mt6701_port_t *reg_a;
+	volatile mt6701_port_t *reg_b;
+	volatile mt6701_port_t *reg_z;
+	mt6701_port_t mask_a;
+	mt6701_port_t mask_b;
+	mt6701_port_t mask_z;
+#endif
+#if defined(ARDUINO_ARCH_ESP32)
+	int unit;
+	volatile int32_t hw_overflow;
+	int32_t hw_raw;			// Counter value at last sync
+	int8_t hw_early;		// Limit reset applied by sync before ISR: +1 high, -1 low
+	portMUX_TYPE mux;
+	static void counter_isr( void *arg );
+	void counter_sync( void );
+#endif
+
+	static MT6701ABZ *instances[MT6701_ABZ_MAX_INSTANCES];
+	static void (*const isr_ab_table[MT6701_ABZ_MAX_INSTANCES])( void );
+	static void (*const isr_z_table[MT6701_ABZ_MAX_INSTANCES])( void );
+
+	bool pins_init( uint8_t pin_a, uint8_t pin_b, int pin_z, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width );
+	bool slot_take( void );
+	bool read_a( void );
+	bool read_b( void );
+	bool read_z( void );
+	void handle_ab( void );
+	void handle_z( void );
+
+	template <uint8_t N>
+	static void MT6701_ISR_ATTR isr_ab( void ) { instances[N]->handle_ab(); }
+
+	template <uint8_t N>
+	static void MT6701_ISR_ATTR isr_z( void ) { instances[N]->handle_z(); }
+};
+
+#endif // MT6701_ABZ_ARDUINO_WRAPPER_H__
@@ -0,0 +1,196 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MT6701Analog.h"
+
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+static MT6701Analog *free_running_instance = NULL;
+
+// Overridden by MT6701_ANALOG_FREE_RUNNING_ISR(), without it ADC interrupt has no handler
+bool __attribute__((weak)) mt6701_analog_free_running_isr_linked( void ){
+	return false;
+}
+
+/*!
+ *  @brief  ADC conversion complete handler, called from ISR defined by MT6701_ANALOG_FREE_RUNNING_ISR()
+ */
+void MT6701Analog::freeRunningIsr( void ){
+	uint16_t value = ADC;
+
+	if(free_running_instance != NULL){
+		free_running_instance->sample(value);
+	}
+}
+#endif
+
+/*!
+ *  @brief  Instantiates a new MT6701Analog class
+ */
+MT6701Analog::MT6701Analog( void ) {
+	this->pin = 0;
+	this->free_running = false;
+	mt6701_analog_init(&this->analog, MT6701_ANALOG_ADC_BITS, 0, 0, 4095);
+}
+
+/*!
+ *  @brief  Start decoding with polled analogRead(), 2^oversample_bits reads per value
+ *  @param  pin Analog pin connected to Analog/PWM output
+ *  @param  start Same as in analogModeSet
+ *  @param  stop Same as in analogModeSet
+ *  @param  oversample_bits Samples per value 2^oversample_bits (0...8), each 4x gives one extra bit
+ *  @return True on success
+ */
+bool MT6701Analog::begin( uint8_t pin, float start, float stop, uint8_t oversample_bits ){
+	uint16_t start_raw;
+	uint16_t stop_raw;
+
+	this->end();
+
+	mt6701_a_start_stop_to_raw(start, stop, &start_raw, &stop_raw);
+	if(mt6701_analog_init(&this->analog, MT6701_ANALOG_ADC_BITS, oversample_bits, start_raw, stop_raw) != MT6701_OK){
+		return false;
+	}
+
+	this->pin = pin;
+	pinMode(pin, INPUT);
+
+	return true;
+}
+
+/*!
+ *  @brief  Start decoding with free running ADC and conversion complete interrupt (ATmega328P),
+ *          CPU not blocked by conversions. Pin must be A0...A7, reference AVCC.
+ *          Sketch must contain MT6701_ANALOG_FREE_RUNNING_ISR(). ADC reconfigured until end()
+ *  @param  pin Analog pin connected to Analog/PWM output
+ *  @param  start Same as in analogModeSet
+ *  @param  stop Same as in analogModeSet
+ *  @param  oversample_bits Samples per value 2^oversample_bits (0...8), each 4x gives one extra bit
+ *  @return True on success, false if platform has no supported free running mode or ISR not defined
+ */
+bool MT6701Analog::beginFreeRunning( uint8_t pin, float start, float stop, uint8_t oversample_bits ){
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+	uint8_t channel;
+
+	if(!mt6701_analog_free_running_isr_linked() || (free_running_instance != NULL)){
+		return false;
+	}
+
+	if(!this->begin(pin, start, stop, oversample_bits)){
+		return false;
+	}
+
+	channel = (pin >= A0) ? (pin - A0) : pin;
+	if(channel > 7){
+		return false;
+	}
+
+	noInterrupts();
+	free_running_instance = this;
+	this->adc_admux = ADMUX;
+	this->adc_adcsra = ADCSRA;
+	this->adc_adcsrb = ADCSRB;
+	ADMUX = (1 << REFS0) | channel;
+	ADCSRB = 0;
+	// Enable, start, auto trigger, interrupt, clk/128 (9.6 kSPS on 16MHz)
+	ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIE) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+	interrupts();
+
+	this->free_running = true;
+	return true;
+#else
+	(void)pin;
+	(void)start;
+	(void)stop;
+	(void)oversample_bits;
+	return false;
+#endif
+}
+
+/*!
+ *  @brief  Stop free running conversion
+ */
+void MT6701Analog::end( void ){
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+	if(this->free_running){
+		noInterrupts();
+		ADCSRA &= ~((1 << ADATE) | (1 << ADIE));
+		// Let last conversion finish before restoring previous setup
+		while(ADCSRA & (1 << ADSC));
+		ADCSRA = (uint8_t)(this->adc_adcsra | (1 << ADIF));
+		ADCSRB = this->adc_adcsrb;
+		ADMUX = this->adc_admux;
+		free_running_instance = NULL;
+		interrupts();
+	}
+#endif
+	this->free_running = false;
+}
+
+/*!
+ *  @brief  Set decimated values at start and stop angles, if output isnt rail to rail
+ *  @param  value_min Value from valueRead() at start angle
+ *  @param  value_max Value from valueRead() at stop angle
+ *  @return True on success
+ */
+bool MT6701Analog::calibrate( uint16_t value_min, uint16_t value_max ){
+	return mt6701_analog_calibrate(&this->analog, value_min, value_max) == MT6701_OK;
+}
+
+/*!
+ *  @brief  Return decimated ADC value. In polled mode performs 2^oversample_bits reads
+ *  @return Value with ADC bits + oversample_bits/2 resolution
+ */
+uint16_t MT6701Analog::valueRead( void ){
+	uint16_t value;
+
+	if(!this->free_running){
+		while(!mt6701_analog_sample(&this->analog, (uint16_t)analogRead(this->pin)));
+		return this->analog.value;
+	}
+
+	noInterrupts();
+	value = this->analog.value;
+	interrupts();
+
+	return value;
+}
+
+/*!
+ *  @brief  Return angle
+ *  @return Raw angle [0...4095]
+ */
+uint16_t MT6701Analog::angleRawRead( void ){
+	return mt6701_analog_angle_raw(&this->analog, this->valueRead());
+}
+
+/*!
+ *  @brief  Return angle
+ *  @return Angle [0...360.0)
+ */
+float MT6701Analog::angleRead( void ){
+	return (float)this->angleRawRead() * (360.0f/4096.0f);
+}
@@ -0,0 +1,92 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ANALOG_ARDUINO_WRAPPER_H__
+#define MT6701_ANALOG_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+#include "mt6701/mt6701_analog.h"
+
+#ifndef MT6701_ANALOG_ADC_BITS
+#if defined(ARDUINO_ARCH_ESP32)
+#define MT6701_ANALOG_ADC_BITS      12
+#else
+#define MT6701_ANALOG_ADC_BITS      10
+#endif
+#endif
+
+// Free running ADC with interrupt on ATmega328P. Opt-in: ADC_vect defined only when sketch places
+// MT6701_ANALOG_FREE_RUNNING_ISR() at file scope. While running library owns ADC (analogRead()
+// on other pins not possible), end() restores it
+#if defined(__AVR_ATmega328P__)
+#define MT6701_ANALOG_FREE_RUNNING_AVAILABLE
+
+#include <avr/interrupt.h>
+
+#define MT6701_ANALOG_FREE_RUNNING_ISR() \
+	bool mt6701_analog_free_running_isr_linked( void ){ return true; } \
+	ISR(ADC_vect){ MT6701Analog::freeRunningIsr(); }
+
+bool mt6701_analog_free_running_isr_linked( void );
+#endif
+
+/*!
+ *  @brief  Decoder for MT6701 analog output
+ */
+class MT6701Analog {
+public:
+	MT6701Analog( void );
+
+	bool begin( uint8_t pin, float start = 0.0f, float stop = 360.0f, uint8_t oversample_bits = 4 );
+	bool beginFreeRunning( uint8_t pin, float start = 0.0f, float stop = 360.0f, uint8_t oversample_bits = 4 );
+	void end( void );
+	bool calibrate( uint16_t value_min, uint16_t value_max );
+
+	uint16_t valueRead( void );
+	uint16_t angleRawRead( void );
+	float angleRead( void );
+
+	mt6701_analog_t *decoder( void ) { return &this->analog; }
+
+	// Internal, called from ADC ISR
+	void sample( uint16_t value ) { mt6701_analog_sample(&this->analog, value); }
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+	static void freeRunningIsr( void );
+#endif
+
+private:
+	mt6701_analog_t analog;
+	uint8_t pin;
+	bool free_running;
+#if defined(MT6701_ANALOG_FREE_RUNNING_AVAILABLE)
+	uint8_t adc_admux;
+	uint8_t adc_adcsra;
+	uint8_t adc_adcsrb;
+#endif
+};
+
+#endif // MT6701_ANALOG_ARDUINO_WRAPPER_H__
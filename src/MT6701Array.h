@@ -0,0 +1,127 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ARRAY_ARDUINO_WRAPPER_H__
+#define MT6701_ARRAY_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+#include "MT6701.h"
+#include "mt6701/mt6701_array.h"
+
+/*!
+ *  @brief  Many encoders on one bus with shared driver handler. Per encoder data kept in
+ *          parallel arrays, 5 bytes per encoder instead of full MT6701 object
+ *  @tparam N Max encoders count
+ */
+template <uint8_t N>
+class MT6701Array {
+public:
+	MT6701Array( void ) {
+		mt6701_array_init(&this->array, &this->bus.handle, select, &this->bus, this->ids, this->angles, this->status, this->errors, N);
+	}
+
+	/*!
+	 * @brief  Use I2C bus, encoder ids are I2C addresses (or see driver() for custom select, e.g. I2C mux)
+	 * @tparam T The type of Wire interface (e.g., TwoWire, SoftWire)
+	 * @param  wire_interface Pointer to the Wire instance, begin() must be called before
+	 * @param  clock I2C clock, Hz, 0 - keep current
+	 */
+	template <typename T>
+	bool beginI2C(T *wire_interface, uint32_t clock = 0) {
+		return this->bus.initializeI2C(wire_interface, MT6701_DEFAULT_ADDRESS, clock);
+	}
+
+	/*!
+	 * @brief  Use SSI, encoder ids are CS pins. Add at least one encoder before
+	 * @param  clock SSI clock, Hz
+	 */
+	bool beginSSI(uint32_t clock = MT6701_SSI_CLOCK) {
+		uint8_t i;
+		if (this->array.count == 0) {
+			return false;
+		}
+		for (i = 0; i < this->array.count; i++) {
+			pinMode(this->ids[i], OUTPUT);
+			digitalWrite(this->ids[i], HIGH);
+		}
+		return this->bus.initializeSSI(this->ids[0], clock);
+	}
+
+	/*!
+	 * @brief  Add encoder
+	 * @param  id I2C address or CS pin
+	 * @return True on success, false if container full
+	 */
+	bool add(uint8_t id) {
+		if (mt6701_array_add(&this->array, id, NULL) != MT6701_OK) {
+			return false;
+		}
+		if (this->bus.handle.interface == MT6701_INTERFACE_SSI) {
+			pinMode(id, OUTPUT);
+			digitalWrite(id, HIGH);
+		}
+		return true;
+	}
+
+	/*!
+	 * @brief  Read all encoders, one bus lock for whole sweep
+	 * @return Failed encoders count, their angles kept from previous read
+	 */
+	uint8_t readAll(void) { return mt6701_array_read_all(&this->array); }
+
+	bool read(uint8_t index) { return mt6701_array_read(&this->array, index) == MT6701_OK; }
+
+	uint8_t count(void) { return this->array.count; }
+	uint16_t angleRawRead(uint8_t index) { return this->angles[index]; }
+	float angleRead(uint8_t index) { return (float)this->angles[index] * (360.0f / 16384.0f); }
+	uint8_t statusRead(uint8_t index) { return this->status[index]; }
+	bool stale(uint8_t index) { return (this->status[index] & MT6701_ARRAY_STALE) != 0; }
+	uint8_t errorsRead(uint8_t index) { return this->errors[index]; }
+
+	// Shared bus settings (retries, SSI clock, CRC check)
+	MT6701 &busGet(void) { return this->bus; }
+	mt6701_array_t *driver(void) { return &this->array; }
+
+private:
+	MT6701 bus;
+	mt6701_array_t array;
+	uint8_t ids[N];
+	uint16_t angles[N];
+	uint8_t status[N];
+	uint8_t errors[N];
+
+	static void select(void *obj, uint8_t id) {
+		MT6701 *bus = (MT6701*)obj;
+		if (bus->handle.interface == MT6701_INTERFACE_I2C) {
+			bus->_i2c_ctx.address = id;
+		} else {
+			bus->cs_pin = id;
+		}
+	}
+};
+
+#endif // MT6701_ARRAY_ARDUINO_WRAPPER_H__
@@ -0,0 +1,60 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_LOCK_ARDUINO_WRAPPER_H__
+#define MT6701_LOCK_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+
+// Critical sections around decoder state shared with pin ISRs (ABZ, UVW, PWM decoders).
+// ESP32 ISR may run on other core, so per instance spinlock used there.
+// Elsewhere interrupt state saved and restored, so getters can be called from user ISR.
+// One MT6701_LOCK per scope
+#if defined(ARDUINO_ARCH_ESP32)
+#define MT6701_LOCK( mux )			portENTER_CRITICAL(mux)
+#define MT6701_UNLOCK( mux )		portEXIT_CRITICAL(mux)
+#define MT6701_LOCK_ISR( mux )		portENTER_CRITICAL_ISR(mux)
+#define MT6701_UNLOCK_ISR( mux )	portEXIT_CRITICAL_ISR(mux)
+#elif defined(__AVR__)
+#define MT6701_LOCK( mux )			uint8_t mt6701_sreg = SREG; cli()
+#define MT6701_UNLOCK( mux )		SREG = mt6701_sreg
+#define MT6701_LOCK_ISR( mux )
+#define MT6701_UNLOCK_ISR( mux )
+#elif defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#define MT6701_LOCK( mux )			uint32_t mt6701_primask; __asm__ volatile("mrs %0, primask\n cpsid i" : "=r"(mt6701_primask) :: "memory")
+#define MT6701_UNLOCK( mux )		__asm__ volatile("msr primask, %0" :: "r"(mt6701_primask) : "memory")
+#define MT6701_LOCK_ISR( mux )
+#define MT6701_UNLOCK_ISR( mux )
+#else
+// Interrupts enabled on unlock, getters must not be called from interrupt context
+#define MT6701_LOCK( mux )			noInterrupts()
+#define MT6701_UNLOCK( mux )		interrupts()
+#define MT6701_LOCK_ISR( mux )
+#define MT6701_UNLOCK_ISR( mux )
+#endif
+
+#endif // MT6701_LOCK_ARDUINO_WRAPPER_H__
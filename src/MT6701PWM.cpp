@@ -0,0 +1,237 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MT6701PWM.h"
+
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+static MT6701PWM *capture_instance = NULL;
+
+// Overridden by MT6701_PWM_CAPTURE_ISR(), without it capture interrupt has no handler
+bool __attribute__((weak)) mt6701_pwm_capture_isr_linked( void ){
+	return false;
+}
+
+/*!
+ *  @brief  Timer1 capture handler, called from ISR defined by MT6701_PWM_CAPTURE_ISR()
+ */
+void MT6701PWM::captureIsr( void ){
+	uint16_t time = ICR1;
+	bool level = (TCCR1B & (1 << ICES1)) != 0;
+
+	// Next edge opposite, flag cleared after edge select change
+	TCCR1B ^= (1 << ICES1);
+	TIFR1 = (1 << ICF1);
+
+	if(capture_instance != NULL){
+		capture_instance->edge(level, time);
+	}
+}
+#endif
+
+MT6701PWM *MT6701PWM::interrupt_instance = NULL;
+
+void MT6701_ISR_ATTR MT6701PWM::isr_pin( void ){
+	MT6701PWM *self = interrupt_instance;
+	uint32_t time;
+	bool level;
+
+	if(self != NULL){
+		time = micros();
+		level = digitalRead(self->pin) == HIGH;
+		MT6701_LOCK_ISR(&self->mux);
+		mt6701_pwm_decoder_edge(&self->pwm, level, time);
+		MT6701_UNLOCK_ISR(&self->mux);
+	}
+}
+
+/*!
+ *  @brief  Instantiates a new MT6701PWM class
+ */
+MT6701PWM::MT6701PWM( void ) {
+	this->backend = BACKEND_NONE;
+	this->pin = 0;
+#if defined(ARDUINO_ARCH_ESP32)
+	portMUX_INITIALIZE(&this->mux);
+#endif
+	mt6701_pwm_decoder_init(&this->pwm, 1000000UL, 32, MT6701_PWM_FREQ_497_2, MT6701_PWM_POL_HIGH, 10);
+}
+
+/*!
+ *  @brief  Start decoding with timer input capture hardware (Timer1, pin 8 on ATmega328P).
+ *          Timer1 runs at F_CPU/8, with 16MHz gives 2 PWM clocks resolution on 994.4 Hz.
+ *          Sketch must contain MT6701_PWM_CAPTURE_ISR(). Whole Timer1 reconfigured until end()
+ *  @param  frequency Same as in pwmModeSet
+ *  @param  polarity Same as in pwmModeSet
+ *  @return True on success, false if platform has no supported capture hardware or ISR not defined
+ */
+bool MT6701PWM::beginCapture( mt6701_pwm_freq_t frequency, mt6701_pwm_pol_t polarity ){
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+	this->end();
+
+	if(!mt6701_pwm_capture_isr_linked() || (capture_instance != NULL)){
+		return false;
+	}
+
+	if(mt6701_pwm_decoder_init(&this->pwm, F_CPU / 8, 16, frequency, polarity, 10) != MT6701_OK){
+		return false;
+	}
+
+	pinMode(MT6701_PWM_CAPTURE_PIN, INPUT);
+
+	MT6701_LOCK(&this->mux);
+	capture_instance = this;
+	this->timer_tccr1a = TCCR1A;
+	this->timer_tccr1b = TCCR1B;
+	this->timer_timsk1 = TIMSK1;
+	TCCR1A = 0;
+	// Noise canceler, rising edge first, clk/8
+	TCCR1B = (1 << ICNC1) | (1 << ICES1) | (1 << CS11);
+	TCNT1 = 0;
+	TIFR1 = (1 << ICF1);
+	TIMSK1 = (1 << ICIE1);
+	MT6701_UNLOCK(&this->mux);
+
+	this->backend = BACKEND_CAPTURE;
+	return true;
+#else
+	(void)frequency;
+	(void)polarity;
+	return false;
+#endif
+}
+
+/*!
+ *  @brief  Start decoding with pin change interrupt and micros() timestamps.
+ *          Resolution ~4 PWM clocks on 994.4 Hz, ~2 on 497.2 Hz
+ *  @param  pin Pin connected to PWM output, must support interrupts
+ *  @param  frequency Same as in pwmModeSet
+ *  @param  polarity Same as in pwmModeSet
+ *  @return True on success
+ */
+bool MT6701PWM::beginInterrupt( uint8_t pin, mt6701_pwm_freq_t frequency, mt6701_pwm_pol_t polarity ){
+	this->end();
+
+	if(interrupt_instance != NULL){
+		return false;
+	}
+
+	if(digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT){
+		return false;
+	}
+
+	if(mt6701_pwm_decoder_init(&this->pwm, 1000000UL, 32, frequency, polarity, 10) != MT6701_OK){
+		return false;
+	}
+
+	this->pin = pin;
+	pinMode(pin, INPUT);
+	interrupt_instance = this;
+	attachInterrupt(digitalPinToInterrupt(pin), isr_pin, CHANGE);
+
+	this->backend = BACKEND_INTERRUPT;
+	return true;
+}
+
+/*!
+ *  @brief  Stop decoding and release capture hardware or interrupt
+ */
+void MT6701PWM::end( void ){
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+	if(this->backend == BACKEND_CAPTURE){
+		MT6701_LOCK(&this->mux);
+		TIMSK1 = this->timer_timsk1;
+		TCCR1A = this->timer_tccr1a;
+		TCCR1B = this->timer_tccr1b;
+		TIFR1 = (1 << ICF1);
+		capture_instance = NULL;
+		MT6701_UNLOCK(&this->mux);
+	}
+#endif
+	if(this->backend == BACKEND_INTERRUPT){
+		detachInterrupt(digitalPinToInterrupt(this->pin));
+		interrupt_instance = NULL;
+	}
+	this->backend = BACKEND_NONE;
+}
+
+/*!
+ *  @brief  Return last decoded angle
+ *  @return Raw angle [0...4095]
+ */
+uint16_t MT6701PWM::angleRawRead( void ){
+	uint16_t angle_raw;
+
+	MT6701_LOCK(&this->mux);
+	angle_raw = this->pwm.angle_raw;
+	MT6701_UNLOCK(&this->mux);
+
+	return angle_raw;
+}
+
+/*!
+ *  @brief  Return last decoded angle
+ *  @return Angle [0...360.0)
+ */
+float MT6701PWM::angleRead( void ){
+	return (float)this->angleRawRead() * (360.0f/4096.0f);
+}
+
+/*!
+ *  @brief  Check if last frame was inside expected period and duty range
+ *  @return True if angle valid
+ */
+bool MT6701PWM::valid( void ){
+	return this->pwm.valid;
+}
+
+/*!
+ *  @brief  Return count of decoded frames (wraps at 65535)
+ *  @return Frames count
+ */
+uint16_t MT6701PWM::framesRead( void ){
+	uint16_t frames;
+
+	MT6701_LOCK(&this->mux);
+	frames = this->pwm.frames;
+	MT6701_UNLOCK(&this->mux);
+
+	return frames;
+}
+
+/*!
+ *  @brief  Return count of out of frame readings (wrong period or duty)
+ *  @return Errors count
+ */
+uint16_t MT6701PWM::errorsRead( void ){
+	uint16_t errors;
+
+	MT6701_LOCK(&this->mux);
+	errors = this->pwm.errors;
+	MT6701_UNLOCK(&this->mux);
+
+	return errors;
+}
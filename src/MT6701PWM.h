@@ -0,0 +1,99 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_PWM_ARDUINO_WRAPPER_H__
+#define MT6701_PWM_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+#include "MT6701Lock.h"
+#include "mt6701/mt6701_pwm_decoder.h"
+
+// Timer1 input capture (pin 8 on UNO/Nano). Opt-in: TIMER1_CAPT_vect defined only when sketch
+// places MT6701_PWM_CAPTURE_ISR() at file scope. While capture runs library owns whole Timer1
+// (Servo, analogWrite on pins 9/10 and other Timer1 users stop working), end() restores it
+#if defined(__AVR_ATmega328P__)
+#define MT6701_PWM_CAPTURE_AVAILABLE
+#define MT6701_PWM_CAPTURE_PIN      8
+
+#include <avr/interrupt.h>
+
+#define MT6701_PWM_CAPTURE_ISR() \
+	bool mt6701_pwm_capture_isr_linked( void ){ return true; } \
+	ISR(TIMER1_CAPT_vect){ MT6701PWM::captureIsr(); }
+
+bool mt6701_pwm_capture_isr_linked( void );
+#endif
+
+/*!
+ *  @brief  Decoder for MT6701 PWM output
+ */
+class MT6701PWM {
+public:
+	MT6701PWM( void );
+
+	bool beginCapture( mt6701_pwm_freq_t frequency = MT6701_PWM_FREQ_497_2, mt6701_pwm_pol_t polarity = MT6701_PWM_POL_HIGH );
+	bool beginInterrupt( uint8_t pin, mt6701_pwm_freq_t frequency = MT6701_PWM_FREQ_497_2, mt6701_pwm_pol_t polarity = MT6701_PWM_POL_HIGH );
+	void end( void );
+
+	uint16_t angleRawRead( void );
+	float angleRead( void );
+	bool valid( void );
+	uint16_t framesRead( void );
+	uint16_t errorsRead( void );
+
+	mt6701_pwm_decoder_t *decoder( void ) { return &this->pwm; }
+
+	// Internal, called from capture ISR
+	void edge( bool level, uint32_t time ) { mt6701_pwm_decoder_edge(&this->pwm, level, time); }
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+	static void captureIsr( void );
+#endif
+
+private:
+	enum Backend {
+		BACKEND_NONE,
+		BACKEND_CAPTURE,
+		BACKEND_INTERRUPT,
+	};
+
+	mt6701_pwm_decoder_t pwm;
+	Backend backend;
+	uint8_t pin;
+#if defined(ARDUINO_ARCH_ESP32)
+	portMUX_TYPE mux;
+#endif
+#if defined(MT6701_PWM_CAPTURE_AVAILABLE)
+	uint8_t timer_tccr1a;
+	uint8_t timer_tccr1b;
+	uint8_t timer_timsk1;
+#endif
+
+	static MT6701PWM *interrupt_instance;
+	static void isr_pin( void );
+};
+
+#endif // MT6701_PWM_ARDUINO_WRAPPER_H__
@@ -0,0 +1,251 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MT6701UVW.h"
+
+#if MT6701_UVW_MAX_INSTANCES > 4
+#error "MT6701_UVW_MAX_INSTANCES must be 4 or less"
+#endif
+
+MT6701UVW *MT6701UVW::instances[MT6701_UVW_MAX_INSTANCES];
+
+void (*const MT6701UVW::isr_table[MT6701_UVW_MAX_INSTANCES])( void ) = {
+	isr<0>,
+#if MT6701_UVW_MAX_INSTANCES > 1
+	isr<1>,
+#endif
+#if MT6701_UVW_MAX_INSTANCES > 2
+	isr<2>,
+#endif
+#if MT6701_UVW_MAX_INSTANCES > 3
+	isr<3>,
+#endif
+};
+
+/*!
+ *  @brief  Instantiates a new MT6701UVW class
+ */
+MT6701UVW::MT6701UVW( void ) {
+	this->slot = -1;
+	this->nanbnz = false;
+#if defined(ARDUINO_ARCH_ESP32)
+	portMUX_INITIALIZE(&this->mux);
+#endif
+	mt6701_uvw_init(&this->uvw, 1);
+	mt6701_abz_init(&this->abz, 1024, MT6701_PULSE_WIDTH_180);
+}
+
+/*!
+ *  @brief  Read U, V, W lines. If all pins on one port, lines sampled with single port read
+ *  @return State (U << 2 | V << 1 | W)
+ */
+uint8_t MT6701_ISR_ATTR MT6701UVW::stateRead( void ){
+	uint8_t state = 0;
+
+#if defined(portInputRegister)
+	if(this->same_port){
+		mt6701_port_t port = *this->regs[0];
+		if(port & this->masks[0]) state |= MT6701_UVW_STATE_U;
+		if(port & this->masks[1]) state |= MT6701_UVW_STATE_V;
+		if(port & this->masks[2]) state |= MT6701_UVW_STATE_W;
+		return state;
+	}
+	if(*this->regs[0] & this->masks[0]) state |= MT6701_UVW_STATE_U;
+	if(*this->regs[1] & this->masks[1]) state |= MT6701_UVW_STATE_V;
+	if(*this->regs[2] & this->masks[2]) state |= MT6701_UVW_STATE_W;
+#else
+	if(digitalRead(this->pins[0]) == HIGH) state |= MT6701_UVW_STATE_U;
+	if(digitalRead(this->pins[1]) == HIGH) state |= MT6701_UVW_STATE_V;
+	if(digitalRead(this->pins[2]) == HIGH) state |= MT6701_UVW_STATE_W;
+#endif
+
+	return state;
+}
+
+void MT6701_ISR_ATTR MT6701UVW::handle_change( void ){
+	uint8_t state = this->stateRead();
+	uint32_t time_us = micros();
+
+	MT6701_LOCK_ISR(&this->mux);
+	if(this->nanbnz){
+		mt6701_uvw_nanbnz_update(&this->abz, state);
+	}else{
+		mt6701_uvw_update(&this->uvw, state, time_us);
+	}
+	MT6701_UNLOCK_ISR(&this->mux);
+}
+
+bool MT6701UVW::pins_attach( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w ){
+	uint8_t i;
+	uint8_t state;
+
+	this->end();
+
+	this->pins[0] = pin_u;
+	this->pins[1] = pin_v;
+	this->pins[2] = pin_w;
+
+	for(i = 0; i < 3; i++){
+		if(digitalPinToInterrupt(this->pins[i]) == NOT_AN_INTERRUPT){
+			return false;
+		}
+		pinMode(this->pins[i], INPUT);
+#if defined(portInputRegister)
+		this->regs[i] = (volatile mt6701_port_t *)portInputRegister(digitalPinToPort(this->pins[i]));
+		this->masks[i] = (mt6701_port_t)digitalPinToBitMask(this->pins[i]);
+#endif
+	}
+#if defined(portInputRegister)
+	this->same_port = (this->regs[0] == this->regs[1]) && (this->regs[1] == this->regs[2]);
+#endif
+
+	for(i = 0; i < MT6701_UVW_MAX_INSTANCES; i++){
+		if(instances[i] == NULL){
+			instances[i] = this;
+			this->slot = i;
+			break;
+		}
+	}
+	if(this->slot < 0){
+		return false;
+	}
+
+	// Initial state, without counting
+	state = this->stateRead();
+	if(this->nanbnz){
+		mt6701_abz_state_set(&this->abz, !(state & MT6701_UVW_STATE_U), !(state & MT6701_UVW_STATE_V), !(state & MT6701_UVW_STATE_W));
+	}else{
+		mt6701_uvw_update(&this->uvw, state, micros());
+	}
+
+	for(i = 0; i < 3; i++){
+		attachInterrupt(digitalPinToInterrupt(this->pins[i]), isr_table[this->slot], CHANGE);
+	}
+
+	return true;
+}
+
+/*!
+ *  @brief  Start decoding UVW outputs, every line change handled in ISR
+ *  @param  pin_u Pin connected to U output
+ *  @param  pin_v Pin connected to V output
+ *  @param  pin_w Pin connected to W output
+ *  @param  pole_pairs Pole pairs, same as in uvwModeSet (1...16)
+ *  @return True on success
+ */
+bool MT6701UVW::begin( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w, uint8_t pole_pairs ){
+	if(mt6701_uvw_init(&this->uvw, pole_pairs) != MT6701_OK){
+		return false;
+	}
+	this->nanbnz = false;
+
+	return this->pins_attach(pin_u, pin_v, pin_w);
+}
+
+/*!
+ *  @brief  Start decoding nAnBnZ outputs of QFN chip (nanbnzEnable(true) and ABZ mode)
+ *  @param  pin_u Pin connected to U (nA) output
+ *  @param  pin_v Pin connected to V (nB) output
+ *  @param  pin_w Pin connected to W (nZ) output
+ *  @param  pulses_per_round Pulses per round, same as in abzModeSet (1...1024)
+ *  @param  z_pulse_width Z pulse width, same as in abzModeSet
+ *  @return True on success
+ */
+bool MT6701UVW::beginNanbnz( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width ){
+	if(mt6701_abz_init(&this->abz, pulses_per_round, z_pulse_width) != MT6701_OK){
+		return false;
+	}
+	this->nanbnz = true;
+
+	return this->pins_attach(pin_u, pin_v, pin_w);
+}
+
+/*!
+ *  @brief  Stop decoding and release interrupts
+ */
+void MT6701UVW::end( void ){
+	if(this->slot < 0){
+		return;
+	}
+
+	for(uint8_t i = 0; i < 3; i++){
+		detachInterrupt(digitalPinToInterrupt(this->pins[i]));
+	}
+	instances[this->slot] = NULL;
+	this->slot = -1;
+}
+
+/*!
+ *  @brief  Return current commutation sector
+ *  @return Sector [0...5] or MT6701_UVW_SECTOR_INVALID
+ */
+uint8_t MT6701UVW::sectorRead( void ){
+	return mt6701_uvw_sector(this->stateRead());
+}
+
+/*!
+ *  @brief  Return sector steps from start, 6 * pole_pairs steps per turn.
+ *          In nAnBnZ mode return quadrature count, 4 counts per pulse
+ *  @return Steps count
+ */
+int32_t MT6701UVW::stepsRead( void ){
+	int32_t steps;
+
+	MT6701_LOCK(&this->mux);
+	steps = this->nanbnz ? this->abz.count : this->uvw.steps;
+	MT6701_UNLOCK(&this->mux);
+
+	return steps;
+}
+
+/*!
+ *  @brief  Return mechanical speed estimated from time between transitions
+ *  @return Speed in RPM
+ */
+float MT6701UVW::rpmRead( void ){
+	mt6701_uvw_t copy;
+
+	MT6701_LOCK(&this->mux);
+	copy = this->uvw;
+	MT6701_UNLOCK(&this->mux);
+
+	return mt6701_uvw_rpm(&copy, micros());
+}
+
+/*!
+ *  @brief  Return count of invalid states (000/111) and skipped sectors
+ *  @return Errors count
+ */
+uint16_t MT6701UVW::errorsRead( void ){
+	uint16_t errors;
+
+	MT6701_LOCK(&this->mux);
+	errors = this->nanbnz ? this->abz.errors : this->uvw.errors;
+	MT6701_UNLOCK(&this->mux);
+
+	return errors;
+}
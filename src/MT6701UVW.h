@@ -0,0 +1,85 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_UVW_ARDUINO_WRAPPER_H__
+#define MT6701_UVW_ARDUINO_WRAPPER_H__
+
+#include <Arduino.h>
+#include "MT6701ABZ.h"
+#include "mt6701/mt6701_uvw.h"
+
+// How many decoders can work at same time
+#ifndef MT6701_UVW_MAX_INSTANCES
+#define MT6701_UVW_MAX_INSTANCES    2
+#endif
+
+/*!
+ *  @brief  Commutation decoder for MT6701 UVW output
+ */
+class MT6701UVW {
+public:
+	MT6701UVW( void );
+
+	bool begin( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w, uint8_t pole_pairs );
+	bool beginNanbnz( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w, uint16_t pulses_per_round = 1024, mt6701_pulse_width_t z_pulse_width = MT6701_PULSE_WIDTH_180 );
+	void end( void );
+
+	uint8_t stateRead( void );
+	uint8_t sectorRead( void );
+	int32_t stepsRead( void );
+	float rpmRead( void );
+	uint16_t errorsRead( void );
+
+	mt6701_uvw_t *decoder( void ) { return &this->uvw; }
+	mt6701_abz_t *decoderNanbnz( void ) { return &this->abz; }
+
+private:
+	mt6701_uvw_t uvw;
+	mt6701_abz_t abz;
+	bool nanbnz;
+	int8_t slot;
+	uint8_t pins[3];
+#if defined(portInputRegister)
+	volatile mt6701_port_t *regs[3];
+	mt6701_port_t masks[3];
+	bool same_port;
+#endif
+#if defined(ARDUINO_ARCH_ESP32)
+	portMUX_TYPE mux;
+#endif
+
+	static MT6701UVW *instances[MT6701_UVW_MAX_INSTANCES];
+	static void (*const isr_table[MT6701_UVW_MAX_INSTANCES])( void );
+
+	bool pins_attach( uint8_t pin_u, uint8_t pin_v, uint8_t pin_w );
+	void handle_change( void );
+
+	template <uint8_t N>
+	static void MT6701_ISR_ATTR isr( void ) { instances[N]->handle_change(); }
+};
+
+#endif // MT6701_UVW_ARDUINO_WRAPPER_H__
@@ -44,7 +44,106 @@ static uint8_t mt6701_check_config_mode( mt6701_handle_t *handle ){
 	return MT6701_OK;
 }
 
-uint8_t mt6701_nanbnz_enable( mt6701_handle_t *handle, bool nanbnz_enable ){	
+void mt6701_bus_lock( mt6701_handle_t *handle ){
+	if((handle != NULL) && (handle->lock != NULL)){
+		handle->lock(handle->lock_object);
+	}
+}
+
+void mt6701_bus_unlock( mt6701_handle_t *handle ){
+	if((handle != NULL) && (handle->unlock != NULL)){
+		handle->unlock(handle->lock_object);
+	}
+}
+
+static void mt6701_i2c_retry_wait( mt6701_handle_t *handle, uint8_t attempt ){
+	uint32_t backoff;
+
+	if(handle->i2c_recover != NULL){
+		handle->i2c_recover(handle->i2c_object);
+	}
+
+	if((handle->delay_us == NULL) || (handle->i2c_backoff_us == 0)){
+		return;
+	}
+
+	backoff = handle->i2c_backoff_us;
+	while((attempt--) && (backoff < MT6701_I2C_BACKOFF_MAX_US)){
+		backoff <<= 1;
+	}
+	if(backoff > MT6701_I2C_BACKOFF_MAX_US){
+		backoff = MT6701_I2C_BACKOFF_MAX_US;
+	}
+	handle->delay_us(backoff);
+}
+
+static uint8_t mt6701_i2c_read( mt6701_handle_t *handle, uint8_t reg, uint8_t *data ){
+	uint8_t res;
+	uint8_t attempt = 0;
+
+	while(1){
+		res = handle->i2c_read(handle->i2c_object, reg, data);
+		if((res == 0) || (attempt >= handle->i2c_retries)){
+			return res;
+		}
+		mt6701_i2c_retry_wait(handle, attempt++);
+	}
+}
+
+static uint8_t mt6701_i2c_write( mt6701_handle_t *handle, uint8_t reg, uint8_t data ){
+	uint8_t res;
+	uint8_t attempt = 0;
+
+	while(1){
+		res = handle->i2c_write(handle->i2c_object, reg, data);
+		if((res == 0) || (attempt >= handle->i2c_retries)){
+			return res;
+		}
+		mt6701_i2c_retry_wait(handle, attempt++);
+	}
+}
+
+static uint8_t mt6701_i2c_read_burst( mt6701_handle_t *handle, uint8_t reg, uint8_t *data, uint8_t len ){
+	uint8_t res;
+	uint8_t attempt = 0;
+
+	while(1){
+		res = handle->i2c_read_burst(handle->i2c_object, reg, data, len);
+		if((res == 0) || (attempt >= handle->i2c_retries)){
+			return res;
+		}
+		mt6701_i2c_retry_wait(handle, attempt++);
+	}
+}
+
+// CRC6 of SSI frame: x^6 + x + 1 over 18 data bits (angle and status), MSB first
+static bool mt6701_ssi_crc_valid( const uint8_t *data ){
+	uint32_t frame;
+	uint8_t crc = 0;
+	uint8_t bit;
+	int8_t i;
+
+	frame = ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | data[2];
+	for(i = 23; i >= 6; i--){
+		bit = (uint8_t)(((frame >> i) & 1) ^ ((crc >> 5) & 1));
+		crc = (uint8_t)((crc << 1) & 0x3F);
+		if(bit){
+			crc ^= 0x03;
+		}
+	}
+
+	return crc == (frame & 0x3F);
+}
+
+static uint8_t mt6701_ssi_read( mt6701_handle_t *handle, uint8_t *data, uint8_t len ){
+	if(handle->ssi_read_obj != NULL){
+		return handle->ssi_read_obj(handle->ssi_object, data, len);
+	}
+
+	return handle->ssi_read(data, len);
+}
+
+static uint8_t mt6701_nanbnz_enable_locked( mt6701_handle_t *handle, bool nanbnz_enable ){	
 	uint8_t res;
 	uint8_t data;
 
@@ -53,7 +152,7 @@ uint8_t mt6701_nanbnz_enable( mt6701_handle_t *handle, bool nanbnz_enable ){
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_UVM_MUX, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_UVM_MUX, &data);
 
 	if(nanbnz_enable){
 		data |= MT6701_REG_UVM_MUX_MASK;
@@ -61,7 +160,7 @@ uint8_t mt6701_nanbnz_enable( mt6701_handle_t *handle, bool nanbnz_enable ){
 		data &= ~MT6701_REG_UVM_MUX_MASK;
 	}
 	
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_UVM_MUX, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_UVM_MUX, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -69,7 +168,17 @@ uint8_t mt6701_nanbnz_enable( mt6701_handle_t *handle, bool nanbnz_enable ){
 	return MT6701_OK;
 }
 
-uint8_t mt6701_abz_pulse_per_round_set( mt6701_handle_t *handle, uint16_t resolution ){
+uint8_t mt6701_nanbnz_enable( mt6701_handle_t *handle, bool nanbnz_enable ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_nanbnz_enable_locked(handle, nanbnz_enable);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_abz_pulse_per_round_set_locked( mt6701_handle_t *handle, uint16_t resolution ){
 	uint8_t res;
 	uint8_t data;
 
@@ -83,12 +192,12 @@ uint8_t mt6701_abz_pulse_per_round_set( mt6701_handle_t *handle, uint16_t resolu
 		return MT6701_ERR_OUT_OF_RANGE;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_ABZ_RES8, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_ABZ_RES8, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_ABZ_RES0, (uint8_t)resolution);
+	res = mt6701_i2c_write(handle, MT6701_REG_ABZ_RES0, (uint8_t)resolution);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -97,7 +206,7 @@ uint8_t mt6701_abz_pulse_per_round_set( mt6701_handle_t *handle, uint16_t resolu
 	data &= ~MT6701_REG_ABZ_RES8_MASK;
 	data |= (uint8_t)(resolution << MT6701_REG_ZERO8_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_ABZ_RES8, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_ABZ_RES8, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -105,7 +214,17 @@ uint8_t mt6701_abz_pulse_per_round_set( mt6701_handle_t *handle, uint16_t resolu
 	return MT6701_OK;
 }
 
-uint8_t mt6701_uvw_pole_pair_set( mt6701_handle_t *handle, uint8_t pole_pairs ){
+uint8_t mt6701_abz_pulse_per_round_set( mt6701_handle_t *handle, uint16_t resolution ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_abz_pulse_per_round_set_locked(handle, resolution);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_uvw_pole_pair_set_locked( mt6701_handle_t *handle, uint8_t pole_pairs ){
 	uint8_t res;
 	uint8_t data;
 
@@ -119,15 +238,15 @@ uint8_t mt6701_uvw_pole_pair_set( mt6701_handle_t *handle, uint8_t pole_pairs ){
 		return MT6701_ERR_OUT_OF_RANGE;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_UVW_RES0, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_UVW_RES0, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
 
 	data &= ~MT6701_REG_UVW_RES0_MASK;
-	data |= (MT6701_REG_UVW_RES0_POS << pole_pairs);
+	data |= (pole_pairs << MT6701_REG_UVW_RES0_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_UVW_RES0, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_UVW_RES0, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -135,7 +254,17 @@ uint8_t mt6701_uvw_pole_pair_set( mt6701_handle_t *handle, uint8_t pole_pairs ){
 	return MT6701_OK;
 }
 
-uint8_t mt6701_mode_set( mt6701_handle_t *handle, mt6701_mode_t mode ){
+uint8_t mt6701_uvw_pole_pair_set( mt6701_handle_t *handle, uint8_t pole_pairs ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_uvw_pole_pair_set_locked(handle, pole_pairs);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_mode_set_locked( mt6701_handle_t *handle, mt6701_mode_t mode ){
 	uint8_t res;
 	uint8_t data;
 
@@ -144,7 +273,7 @@ uint8_t mt6701_mode_set( mt6701_handle_t *handle, mt6701_mode_t mode ){
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_ABZ_MUX, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_ABZ_MUX, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -155,7 +284,7 @@ uint8_t mt6701_mode_set( mt6701_handle_t *handle, mt6701_mode_t mode ){
 		data &= ~MT6701_REG_ABZ_MUX_MASK;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_ABZ_MUX, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_ABZ_MUX, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -163,6 +292,16 @@ uint8_t mt6701_mode_set( mt6701_handle_t *handle, mt6701_mode_t mode ){
 	return MT6701_OK;
 }
 
+uint8_t mt6701_mode_set( mt6701_handle_t *handle, mt6701_mode_t mode ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_mode_set_locked(handle, mode);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
 uint8_t mt6701_interface_set( mt6701_handle_t *handle, mt6701_interface_t interface ){
 	if(handle == NULL){
 		return MT6701_ERR_HANDLER_NULL;
@@ -174,7 +313,71 @@ uint8_t mt6701_interface_set( mt6701_handle_t *handle, mt6701_interface_t interf
 	return MT6701_OK;
 }
 
-uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle ){
+uint8_t mt6701_lock_set( mt6701_handle_t *handle, void (*lock)( void *obj ), void (*unlock)( void *obj ), void *lock_object ){
+	if(handle == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((lock == NULL) != (unlock == NULL)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	handle->lock = lock;
+	handle->unlock = unlock;
+	handle->lock_object = lock_object;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_i2c_retry_set( mt6701_handle_t *handle, uint8_t retries, uint16_t backoff_us ){
+	if(handle == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	handle->i2c_retries = retries;
+	handle->i2c_backoff_us = backoff_us;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_ssi_crc_check_set( mt6701_handle_t *handle, bool enable ){
+	if(handle == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	handle->ssi_crc_check = enable;
+
+	return MT6701_OK;
+}
+
+static uint8_t mt6701_ssi_clock_set_locked( mt6701_handle_t *handle, uint32_t clock ){
+	if(handle->ssi_clock_set == NULL){
+		return MT6701_ERR_CONFIG_UNAVAILABLE;
+	}
+
+	if((clock == 0) || (handle->ssi_clock_set(handle->ssi_object, clock) != 0)){
+		return MT6701_ERR_GENERAL;
+	}
+	handle->ssi_clock = clock;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_ssi_clock_set( mt6701_handle_t *handle, uint32_t clock ){
+	uint8_t res;
+
+	if(handle == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	mt6701_bus_lock(handle);
+	res = mt6701_ssi_clock_set_locked(handle, clock);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_zero_set_raw_locked( mt6701_handle_t *handle, uint16_t zero_angle ){
 	uint8_t res;
 	uint8_t data;
 
@@ -185,12 +388,12 @@ uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle ){
 	
 	zero_angle &= 0x0FFF;	
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_ZERO0, (uint8_t)zero_angle);
+	res = mt6701_i2c_write(handle, MT6701_REG_ZERO0, (uint8_t)zero_angle);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_ZERO8, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_ZERO8, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -199,7 +402,7 @@ uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle ){
 	data &= ~MT6701_REG_ZERO8_MASK;
 	data |= (zero_angle << MT6701_REG_ZERO8_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_ZERO8, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_ZERO8, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -207,6 +410,16 @@ uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle ){
 	return MT6701_OK;
 }
 
+uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_zero_set_raw_locked(handle, zero_angle);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
 uint8_t mt6701_zero_set( mt6701_handle_t *handle, float zero_angle ){
 	uint8_t res;
 	uint16_t data;
@@ -217,7 +430,148 @@ uint8_t mt6701_zero_set( mt6701_handle_t *handle, float zero_angle ){
 	return res;
 }
 
-uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
+static uint8_t mt6701_zero_get_raw_locked( mt6701_handle_t *handle, uint16_t *zero_angle ){
+	uint8_t res;
+	uint8_t data_hi;
+	uint8_t data_lo;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != 0){
+		return res;
+	}
+
+	res = mt6701_i2c_read(handle, MT6701_REG_ZERO8, &data_hi);
+	if(res != 0){
+		return MT6701_ERR_IO;
+	}
+
+	res = mt6701_i2c_read(handle, MT6701_REG_ZERO0, &data_lo);
+	if(res != 0){
+		return MT6701_ERR_IO;
+	}
+
+	if(zero_angle != NULL){
+		*zero_angle  = (uint16_t)((data_hi & MT6701_REG_ZERO8_MASK) >> MT6701_REG_ZERO8_POS) << 8;
+		*zero_angle |= (uint16_t)((data_lo & MT6701_REG_ZERO0_MASK) >> MT6701_REG_ZERO0_POS);
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_zero_get_raw( mt6701_handle_t *handle, uint16_t *zero_angle ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_zero_get_raw_locked(handle, zero_angle);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+// Circular mean of raw readings, every sample unwrapped relative to first one
+static uint8_t mt6701_read_mean( mt6701_handle_t *handle, uint16_t samples, int16_t *mean ){
+	uint8_t res;
+	uint16_t i;
+	uint16_t angle_raw;
+	uint16_t first = 0;
+	int32_t sum = 0;
+	int16_t delta;
+
+	for(i = 0; i < samples; i++){
+		res = mt6701_read_raw(handle, &angle_raw, NULL, NULL, NULL);
+		if(res != MT6701_OK){
+			return res;
+		}
+		if(i == 0){
+			first = angle_raw;
+		}
+		delta = (int16_t)((uint16_t)(angle_raw - first) << 2) >> 2;
+		sum += delta;
+	}
+
+	// Rounded mean, wrapped to signed half turn
+	if(sum >= 0){
+		sum = (sum + samples / 2) / samples;
+	}else{
+		sum = -((-sum + samples / 2) / samples);
+	}
+	*mean = (int16_t)((uint16_t)(first + sum) << 2) >> 2;
+
+	return MT6701_OK;
+}
+
+static uint8_t mt6701_zero_auto_locked( mt6701_handle_t *handle, uint16_t samples, uint16_t tolerance, bool program, uint16_t *zero_angle ){
+	uint8_t res;
+	uint16_t zero_old;
+	uint16_t zero_new;
+	uint16_t verify_samples;
+	int16_t mean;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != 0){
+		return res;
+	}
+
+	if((samples == 0) || (samples > 4096)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	res = mt6701_read_mean(handle, samples, &mean);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	res = mt6701_zero_get_raw(handle, &zero_old);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	// Reading already shifted by current zero, 14 bit mean rounded to 12 bit zero
+	zero_new = (uint16_t)(zero_old + ((mean + 2) >> 2)) & 0x0FFF;
+	res = mt6701_zero_set_raw(handle, zero_new);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	verify_samples = samples / 4;
+	if(verify_samples == 0){
+		verify_samples = 1;
+	}
+	res = mt6701_read_mean(handle, verify_samples, &mean);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	if((uint16_t)abs(mean) > tolerance){
+		mt6701_zero_set_raw(handle, zero_old);
+		return MT6701_ERR_GENERAL;
+	}
+
+	if(program){
+		res = mt6701_programm_eeprom(handle);
+		if(res != MT6701_OK){
+			return res;
+		}
+	}
+
+	if(zero_angle != NULL){
+		*zero_angle = zero_new;
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_zero_auto( mt6701_handle_t *handle, uint16_t samples, uint16_t tolerance, bool program, uint16_t *zero_angle ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_zero_auto_locked(handle, samples, tolerance, program, zero_angle);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_hyst_set_locked( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
 	uint8_t res;
 	uint8_t data;
 	uint8_t hyst_lo;
@@ -228,7 +582,7 @@ uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
 		return 1;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_HYST0, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_HYST0, &data);
 	if(res != 0){
 		return 1;
 	}
@@ -237,12 +591,12 @@ uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
 	data &= ~MT6701_REG_HYST0_MASK;
 	data |= (hyst_lo << MT6701_REG_HYST0_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_HYST0, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_HYST0, data);
 	if(res != 0){
 		return 1;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_HYST2, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_HYST2, &data);
 	if(res != 0){
 		return 1;
 	}
@@ -251,7 +605,7 @@ uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
 	data &= ~MT6701_REG_HYST2_MASK;
 	data |= (hyst_hi << MT6701_REG_HYST2_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_HYST2, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_HYST2, data);
 	if(res != 0){
 		return 1;
 	}
@@ -259,7 +613,17 @@ uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
 	return MT6701_OK;
 }
 
-uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, uint16_t stop ){
+uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_hyst_set_locked(handle, hysteresis);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_a_start_stop_set_raw_locked( mt6701_handle_t *handle, uint16_t start, uint16_t stop ){
 	uint8_t res;
 	uint8_t data;
 
@@ -276,12 +640,12 @@ uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, ui
 		return MT6701_ERR_OUT_OF_RANGE;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_A_START0, (uint8_t)start);
+	res = mt6701_i2c_write(handle, MT6701_REG_A_START0, (uint8_t)start);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_A_STOP0, (uint8_t)stop);
+	res = mt6701_i2c_write(handle, MT6701_REG_A_STOP0, (uint8_t)stop);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -290,7 +654,7 @@ uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, ui
 	stop  >>= 8;
 	data = (start << MT6701_REG_A_START8_POS) | (stop << MT6701_REG_A_STOP8_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_A_START8, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_A_START8, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -298,8 +662,17 @@ uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, ui
 	return MT6701_OK;
 }
 
-uint8_t mt6701_a_start_stop_set( mt6701_handle_t *handle, float start, float stop ){
+uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, uint16_t stop ){
 	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_a_start_stop_set_raw_locked(handle, start, stop);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+void mt6701_a_start_stop_to_raw( float start, float stop, uint16_t *start_raw, uint16_t *stop_raw ){
 	uint16_t start_u16;
 	uint16_t stop_u16;
 
@@ -311,11 +684,22 @@ uint8_t mt6701_a_start_stop_set( mt6701_handle_t *handle, float start, float sto
 	if(stop_u16 >= 4096){
 		stop_u16 = 4095;
 	}
+
+	*start_raw = start_u16;
+	*stop_raw = stop_u16;
+}
+
+uint8_t mt6701_a_start_stop_set( mt6701_handle_t *handle, float start, float stop ){
+	uint8_t res;
+	uint16_t start_u16;
+	uint16_t stop_u16;
+
+	mt6701_a_start_stop_to_raw(start, stop, &start_u16, &stop_u16);
 	res = mt6701_a_start_stop_set_raw(handle, start_u16, stop_u16);
 	return res;
 }
 
-uint8_t mt6701_direction_set( mt6701_handle_t *handle, mt6701_direction_t direction ){
+static uint8_t mt6701_direction_set_locked( mt6701_handle_t *handle, mt6701_direction_t direction ){
 	uint8_t res;
 	uint8_t data;
 
@@ -324,7 +708,7 @@ uint8_t mt6701_direction_set( mt6701_handle_t *handle, mt6701_direction_t direct
 		return MT6701_ERR_HANDLER_NULL;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_DIR, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_DIR, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -337,7 +721,7 @@ uint8_t mt6701_direction_set( mt6701_handle_t *handle, mt6701_direction_t direct
 		return MT6701_ERR_GENERAL;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_DIR, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_DIR, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -345,7 +729,17 @@ uint8_t mt6701_direction_set( mt6701_handle_t *handle, mt6701_direction_t direct
 	return MT6701_OK;
 }
 
-uint8_t mt6701_pulse_width_set( mt6701_handle_t *handle, mt6701_pulse_width_t pulse_width ){
+uint8_t mt6701_direction_set( mt6701_handle_t *handle, mt6701_direction_t direction ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_direction_set_locked(handle, direction);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_pulse_width_set_locked( mt6701_handle_t *handle, mt6701_pulse_width_t pulse_width ){
 	uint8_t res;
 	uint8_t data;
 
@@ -354,7 +748,7 @@ uint8_t mt6701_pulse_width_set( mt6701_handle_t *handle, mt6701_pulse_width_t pu
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_PULSE_WIDTH, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_PULSE_WIDTH, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -362,7 +756,7 @@ uint8_t mt6701_pulse_width_set( mt6701_handle_t *handle, mt6701_pulse_width_t pu
 	data &= ~MT6701_REG_PULSE_WIDTH_MASK;
 	data |= (pulse_width << MT6701_REG_PULSE_WIDTH_POS);
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_PULSE_WIDTH, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_PULSE_WIDTH, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -370,7 +764,17 @@ uint8_t mt6701_pulse_width_set( mt6701_handle_t *handle, mt6701_pulse_width_t pu
 	return MT6701_OK;
 }
 
-uint8_t mt6701_pwm_freq_set( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq ){
+uint8_t mt6701_pulse_width_set( mt6701_handle_t *handle, mt6701_pulse_width_t pulse_width ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_pulse_width_set_locked(handle, pulse_width);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_pwm_freq_set_locked( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq ){
 	uint8_t res;
 	uint8_t data;
 
@@ -379,7 +783,7 @@ uint8_t mt6701_pwm_freq_set( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_PWM_FREQ, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_PWM_FREQ, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -392,7 +796,7 @@ uint8_t mt6701_pwm_freq_set( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq
 		return MT6701_ERR_GENERAL;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_PWM_FREQ, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_PWM_FREQ, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -400,7 +804,17 @@ uint8_t mt6701_pwm_freq_set( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq
 	return MT6701_OK;
 }
 
-uint8_t mt6701_pwm_polarity_set( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_polarity ){
+uint8_t mt6701_pwm_freq_set( mt6701_handle_t *handle, mt6701_pwm_freq_t pwm_freq ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_pwm_freq_set_locked(handle, pwm_freq);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_pwm_polarity_set_locked( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_polarity ){
 	uint8_t res;
 	uint8_t data;
 
@@ -409,7 +823,7 @@ uint8_t mt6701_pwm_polarity_set( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_p
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_PWM_POL, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_PWM_POL, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -422,7 +836,7 @@ uint8_t mt6701_pwm_polarity_set( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_p
 		return MT6701_ERR_GENERAL;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_PWM_POL, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_PWM_POL, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -430,7 +844,17 @@ uint8_t mt6701_pwm_polarity_set( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_p
 	return MT6701_OK;
 }
 
-uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode ){
+uint8_t mt6701_pwm_polarity_set( mt6701_handle_t *handle, mt6701_pwm_pol_t pwm_polarity ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_pwm_polarity_set_locked(handle, pwm_polarity);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_out_mode_set_locked( mt6701_handle_t *handle, mt6701_out_mode_t out_mode ){
 	uint8_t res;
 	uint8_t data;
 
@@ -439,7 +863,7 @@ uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_PWM_POL, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_PWM_POL, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -452,7 +876,7 @@ uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode
 		return MT6701_ERR_GENERAL;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_OUT_MODE, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_OUT_MODE, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -460,7 +884,17 @@ uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode
 	return MT6701_OK;
 }
 
-uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate ){
+uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_out_mode_set_locked(handle, out_mode);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_i2c_addr_alt_set_locked( mt6701_handle_t *handle, bool use_alternate ){
 	uint8_t res;
 	uint8_t data;
 
@@ -469,7 +903,7 @@ uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate ){
 		return res;
 	}
 
-	res = handle->i2c_read(handle->i2c_object, MT6701_REG_I2C_ADDR, &data);
+	res = mt6701_i2c_read(handle, MT6701_REG_I2C_ADDR, &data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -480,7 +914,7 @@ uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate ){
 		data &= ~MT6701_REG_I2C_ADDR_ALT_MASK;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, MT6701_REG_I2C_ADDR, data);
+	res = mt6701_i2c_write(handle, MT6701_REG_I2C_ADDR, data);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
@@ -490,6 +924,138 @@ uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate ){
 	return MT6701_OK;
 }
 
+uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_i2c_addr_alt_set_locked(handle, use_alternate);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_probe_locked( mt6701_handle_t *handle, uint8_t address ){
+	uint8_t res;
+	uint8_t data;
+	uint8_t retries;
+	uint16_t angle_raw;
+	bool alternate;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	// Missing device must fail fast, without retries
+	retries = handle->i2c_retries;
+	handle->i2c_retries = 0;
+
+	res = mt6701_i2c_read(handle, MT6701_REG_I2C_ADDR, &data);
+	if(res == 0){
+		res = mt6701_read_raw(handle, &angle_raw, NULL, NULL, NULL);
+	}else{
+		res = MT6701_ERR_IO;
+	}
+
+	handle->i2c_retries = retries;
+
+	if(res != MT6701_OK){
+		return MT6701_ERR_IO;
+	}
+
+	// Address bit must match address device answered on
+	alternate = (data & MT6701_REG_I2C_ADDR_ALT_MASK) != 0;
+	if(alternate != (address == MT6701_ALTERNATE_ADDRESS)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_probe( mt6701_handle_t *handle, uint8_t address ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_probe_locked(handle, address);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+uint8_t mt6701_reg_read( mt6701_handle_t *handle, uint8_t reg, uint8_t *data ){
+	uint8_t res;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	mt6701_bus_lock(handle);
+	res = mt6701_i2c_read(handle, reg, data);
+	mt6701_bus_unlock(handle);
+
+	return (res == 0) ? MT6701_OK : MT6701_ERR_IO;
+}
+
+uint8_t mt6701_reg_write( mt6701_handle_t *handle, uint8_t reg, uint8_t data ){
+	uint8_t res;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	mt6701_bus_lock(handle);
+	res = mt6701_i2c_write(handle, reg, data);
+	mt6701_bus_unlock(handle);
+
+	return (res == 0) ? MT6701_OK : MT6701_ERR_IO;
+}
+
+uint8_t mt6701_reg_read_block( mt6701_handle_t *handle, uint8_t reg, uint8_t *data, uint8_t len ){
+	uint8_t res = 0;
+	uint8_t i;
+
+	res = mt6701_check_config_mode(handle);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	if((data == NULL) || ((uint16_t)reg + len > 256)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	mt6701_bus_lock(handle);
+	if(handle->i2c_read_burst != NULL){
+		res = mt6701_i2c_read_burst(handle, reg, data, len);
+	}else{
+		for(i = 0; (i < len) && (res == 0); i++){
+			res = mt6701_i2c_read(handle, (uint8_t)(reg + i), &data[i]);
+		}
+	}
+	mt6701_bus_unlock(handle);
+
+	return (res == 0) ? MT6701_OK : MT6701_ERR_IO;
+}
+
+uint8_t mt6701_crc8( const uint8_t *data, uint16_t len ){
+	uint8_t crc = 0;
+	uint8_t i;
+
+	while(len--){
+		crc ^= *data++;
+		for(i = 0; i < 8; i++){
+			if(crc & 0x80){
+				crc = (uint8_t)((crc << 1) ^ 0x07);
+			}else{
+				crc <<= 1;
+			}
+		}
+	}
+
+	return crc;
+}
+
 uint8_t mt6701_init( mt6701_handle_t *handle ){
 	if(handle == NULL){
 		return MT6701_ERR_HANDLER_NULL;
@@ -506,7 +1072,7 @@ uint8_t mt6701_init( mt6701_handle_t *handle ){
 			return MT6701_ERR_GENERAL;
 		}
 	}else if(handle->interface == MT6701_INTERFACE_SSI){
-		if(handle->ssi_read == NULL){
+		if((handle->ssi_read == NULL) && (handle->ssi_read_obj == NULL)){
 			return MT6701_ERR_GENERAL;
 		}
 	}
@@ -520,7 +1086,7 @@ uint8_t mt6701_init( mt6701_handle_t *handle ){
 	return MT6701_OK;
 }
 
-uint8_t mt6701_programm_eeprom( mt6701_handle_t *handle ){
+static uint8_t mt6701_programm_eeprom_start_locked( mt6701_handle_t *handle ){
 	uint8_t res;
 
 	res = mt6701_check_config_mode(handle);
@@ -528,27 +1094,63 @@ uint8_t mt6701_programm_eeprom( mt6701_handle_t *handle ){
 		return res;
 	}
 
-	if(handle->delay == NULL){
-		return MT6701_ERR_GENERAL;
+	res = mt6701_i2c_write(handle, 0x09, 0xB3);
+	if(res != 0){
+		return MT6701_ERR_IO;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, 0x09, 0xB3);
+	res = mt6701_i2c_write(handle, 0x0A, 0x05);
 	if(res != 0){
 		return MT6701_ERR_IO;
 	}
 
-	res = handle->i2c_write(handle->i2c_object, 0x0A, 0x05);
+	return MT6701_OK;
+}
+
+uint8_t mt6701_programm_eeprom_start( mt6701_handle_t *handle ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_programm_eeprom_start_locked(handle);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_programm_eeprom_locked( mt6701_handle_t *handle ){
+	uint8_t res;
+
+	res = mt6701_check_config_mode(handle);
 	if(res != 0){
-		return MT6701_ERR_IO;
+		return res;
+	}
+
+	if(handle->delay == NULL){
+		return MT6701_ERR_GENERAL;
+	}
+
+	res = mt6701_programm_eeprom_start_locked(handle);
+	if(res != MT6701_OK){
+		return res;
 	}
 	handle->initialized = false;
-	handle->delay(600);
+	handle->delay(MT6701_EEPROM_PROGRAM_MS);
 	handle->initialized = true;
 
 	return MT6701_OK;
 }
 
-uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_status_t *field_status, bool *button_pushed, bool *track_loss ){
+uint8_t mt6701_programm_eeprom( mt6701_handle_t *handle ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_programm_eeprom_locked(handle);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+static uint8_t mt6701_read_raw_locked( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_status_t *field_status, bool *button_pushed, bool *track_loss ){
 	uint8_t res;
 	uint8_t data[3];
 	uint8_t status;
@@ -562,13 +1164,22 @@ uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_st
 		return MT6701_ERR_UNINITITIALIZED;
 	}
 
-	if(handle->interface == MT6701_INTERFACE_I2C){
-		res = handle->i2c_read(handle->i2c_object, MT6701_REG_ANGLE6, &data[1]);
+	if((handle->interface == MT6701_INTERFACE_I2C) && (handle->i2c_read_burst != NULL)){
+		// ANGLE6 and ANGLE0 in one transaction
+		res = mt6701_i2c_read_burst(handle, MT6701_REG_ANGLE6, data, 2);
+		if(res != 0){
+			return MT6701_ERR_IO;
+		}
+
+		angle_u16  = (uint16_t)(data[1] >> MT6701_REG_ANGLE0_POS);
+		angle_u16 |= ((uint16_t)data[0] << (8-MT6701_REG_ANGLE0_POS));
+	}else if(handle->interface == MT6701_INTERFACE_I2C){
+		res = mt6701_i2c_read(handle, MT6701_REG_ANGLE6, &data[1]);
 		if(res != 0){
 			return MT6701_ERR_IO;
 		}
 		
-		res = handle->i2c_read(handle->i2c_object, MT6701_REG_ANGLE0, &data[0]);
+		res = mt6701_i2c_read(handle, MT6701_REG_ANGLE0, &data[0]);
 		if(res != 0){
 			return MT6701_ERR_IO;
 		}
@@ -576,7 +1187,7 @@ uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_st
 		angle_u16  = (uint16_t)(data[0] >> MT6701_REG_ANGLE0_POS);
   		angle_u16 |= ((uint16_t)data[1] << (8-MT6701_REG_ANGLE0_POS));
 	}else{
-		res = handle->ssi_read(data, 3);
+		res = mt6701_ssi_read(handle, data, 3);
 		if(res != 0){
 			return MT6701_ERR_IO;
 		}
@@ -587,7 +1198,9 @@ uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_st
 		status  = (data[2] >> 6);
 		status |= (data[1] & 0x03) << 2;
 
-		// I dont check CRC6, becouse i soo stupid to implement this rare shit
+		if(handle->ssi_crc_check && !mt6701_ssi_crc_valid(data)){
+			return MT6701_ERR_IO;
+		}
 
 		if(field_status != NULL){
 			*field_status = status & 0x03;
@@ -616,6 +1229,140 @@ uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_st
 	return MT6701_OK;
 }
 
+uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_status_t *field_status, bool *button_pushed, bool *track_loss ){
+	uint8_t res;
+
+	mt6701_bus_lock(handle);
+	res = mt6701_read_raw_locked(handle, angle_raw, field_status, button_pushed, track_loss);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+// Frames of one clock valid if CRC correct and angle close to previous frame (also from previous clock)
+static bool mt6701_ssi_clock_check( mt6701_handle_t *handle, uint16_t reads, uint16_t *reference, bool *has_reference ){
+	uint16_t angle;
+	int16_t diff;
+
+	while(reads--){
+		if(mt6701_read_raw_locked(handle, &angle, NULL, NULL, NULL) != MT6701_OK){
+			return false;
+		}
+		if(*has_reference){
+			diff = (int16_t)((angle - *reference) & 0x3FFF);
+			if(diff >= 0x2000){
+				diff -= 0x4000;
+			}
+			if((diff > MT6701_SSI_TUNE_TOLERANCE) || (diff < -MT6701_SSI_TUNE_TOLERANCE)){
+				return false;
+			}
+		}
+		*reference = angle;
+		*has_reference = true;
+	}
+
+	return true;
+}
+
+static uint8_t mt6701_ssi_clock_tune_locked( mt6701_handle_t *handle, const uint32_t *clocks, uint8_t count, uint16_t reads, uint32_t *clock ){
+	uint32_t previous_clock = handle->ssi_clock;
+	bool previous_crc = handle->ssi_crc_check;
+	bool has_reference = false;
+	uint16_t reference = 0;
+	bool failed = false;
+	int16_t best = -1;
+	uint8_t res;
+	uint8_t i;
+
+	if(handle->ssi_clock_set == NULL){
+		return MT6701_ERR_CONFIG_UNAVAILABLE;
+	}
+
+	handle->ssi_crc_check = true;
+	for(i = 0; i < count; i++){
+		if((mt6701_ssi_clock_set_locked(handle, clocks[i]) != MT6701_OK) ||
+		   !mt6701_ssi_clock_check(handle, reads, &reference, &has_reference)){
+			failed = true;
+			break;
+		}
+		best = i;
+	}
+	handle->ssi_crc_check = previous_crc;
+
+	if(best < 0){
+		if(previous_clock != 0){
+			mt6701_ssi_clock_set_locked(handle, previous_clock);
+		}
+		return MT6701_ERR_IO;
+	}
+
+	// Passed clock next to failed one can be marginal
+	if(failed){
+		best = (best > MT6701_SSI_TUNE_MARGIN_STEPS) ? (best - MT6701_SSI_TUNE_MARGIN_STEPS) : 0;
+	}
+
+	res = mt6701_ssi_clock_set_locked(handle, clocks[best]);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	if(clock != NULL){
+		*clock = clocks[best];
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_ssi_clock_tune( mt6701_handle_t *handle, const uint32_t *clocks, uint8_t count, uint16_t reads, uint32_t *clock ){
+	uint8_t res;
+
+	if((handle == NULL) || (clocks == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((count == 0) || (reads == 0)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if(handle->interface != MT6701_INTERFACE_SSI){
+		return MT6701_ERR_CONFIG_UNAVAILABLE;
+	}
+
+	mt6701_bus_lock(handle);
+	res = mt6701_ssi_clock_tune_locked(handle, clocks, count, reads, clock);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+uint8_t mt6701_read_sample( mt6701_handle_t *handle, mt6701_sample_t *sample ){
+	uint8_t res;
+	uint16_t angle_u16;
+	mt6701_status_t field_status = MT6701_STATUS_NORM;
+	bool button_pushed = false;
+	bool track_loss = false;
+
+	if(sample == NULL){
+		return MT6701_ERR_GENERAL;
+	}
+
+	res = mt6701_read_raw(handle, &angle_u16, &field_status, &button_pushed, &track_loss);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	sample->angle_raw = angle_u16;
+	sample->status = 0;
+	if(handle->interface == MT6701_INTERFACE_SSI){
+		sample->status  = (uint8_t)field_status & MT6701_SAMPLE_FIELD_MASK;
+		sample->status |= button_pushed ? MT6701_SAMPLE_BUTTON : 0;
+		sample->status |= track_loss ? MT6701_SAMPLE_TRACK_LOSS : 0;
+		sample->status |= MT6701_SAMPLE_STATUS_VALID;
+	}
+
+	return MT6701_OK;
+}
+
 uint8_t mt6701_read( mt6701_handle_t *handle, float *angle, mt6701_status_t *field_status, bool *button_pushed, bool *track_loss ){
 	uint8_t res;
 	uint16_t angle_u16;
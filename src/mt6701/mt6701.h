@@ -34,6 +34,44 @@ SOFTWARE.
 #define MT6701_DEFAULT_ADDRESS				0x06
 #define MT6701_ALTERNATE_ADDRESS			0x46
 
+#define MT6701_EEPROM_PROGRAM_MS			600
+
+// I2C retries after failed transaction and first retry delay, defaults of Arduino wrapper and host tools
+#ifndef MT6701_I2C_RETRIES
+#define MT6701_I2C_RETRIES					2
+#endif
+
+#ifndef MT6701_I2C_BACKOFF_US
+#define MT6701_I2C_BACKOFF_US				100
+#endif
+
+// Max delay between I2C retries, backoff doubled on every retry up to this value
+#ifndef MT6701_I2C_BACKOFF_MAX_US
+#define MT6701_I2C_BACKOFF_MAX_US			2000
+#endif
+
+// Max raw angle change between back to back SSI frames during clock tuning
+#ifndef MT6701_SSI_TUNE_TOLERANCE
+#define MT6701_SSI_TUNE_TOLERANCE			64
+#endif
+
+// Clock steps below first failed clock selected by tuning
+#ifndef MT6701_SSI_TUNE_MARGIN_STEPS
+#define MT6701_SSI_TUNE_MARGIN_STEPS		1
+#endif
+
+// Placement of code and data used from interrupt handlers, must stay in RAM on ESP32
+#ifndef MT6701_ISR_ATTR
+#if defined(ARDUINO_ARCH_ESP32)
+#include "esp_attr.h"
+#define MT6701_ISR_ATTR						IRAM_ATTR
+#define MT6701_ISR_DATA						DRAM_ATTR
+#else
+#define MT6701_ISR_ATTR
+#define MT6701_ISR_DATA
+#endif
+#endif
+
 #define MT6701_OK							0
 #define MT6701_ERR_GENERAL					1
 #define MT6701_ERR_HANDLER_NULL				2
@@ -168,12 +206,36 @@ typedef enum{
 	MT6701_STATUS_FIELD_ERROR	= 0x3,
 } mt6701_status_t;
 
+// Sample status bits, same layout as SSI frame status
+#define MT6701_SAMPLE_FIELD_MASK			0x03
+#define MT6701_SAMPLE_BUTTON				0x04
+#define MT6701_SAMPLE_TRACK_LOSS			0x08
+#define MT6701_SAMPLE_STATUS_VALID			0x10
+
+typedef struct{
+	uint16_t angle_raw;
+	uint8_t status;
+} mt6701_sample_t;
+
 typedef struct{
 	void *i2c_object;
 	uint8_t (*i2c_read)( void *obj, uint8_t reg, uint8_t *data );
 	uint8_t (*i2c_write)( void *obj, uint8_t reg, uint8_t data );
+	uint8_t (*i2c_read_burst)( void *obj, uint8_t reg, uint8_t *data, uint8_t len );	// Optional, sequential registers in one transaction
+	uint8_t (*i2c_recover)( void *obj );	// Optional, bus recovery before retry
 	uint8_t (*ssi_read)( uint8_t *data, uint8_t len );
+	void *ssi_object;
+	uint8_t (*ssi_read_obj)( void *obj, uint8_t *data, uint8_t len );	// Optional, used instead of ssi_read if set
+	uint8_t (*ssi_clock_set)( void *obj, uint32_t clock );	// Optional, called with ssi_object, needed for SSI clock tuning
+	uint32_t ssi_clock;					// SSI clock, Hz, set by mt6701_ssi_clock_set/mt6701_ssi_clock_tune
+	bool ssi_crc_check;					// Reject SSI frames with wrong CRC6
 	void (*delay)( uint32_t ms );
+	void (*delay_us)( uint32_t us );	// Optional, retry backoff
+	void *lock_object;					// Same for all handlers on one bus
+	void (*lock)( void *obj );			// Optional, must be recursive
+	void (*unlock)( void *obj );
+	uint16_t i2c_backoff_us;
+	uint8_t i2c_retries;
 	mt6701_interface_t interface;
 	mt6701_mode_t mode;
 	bool initialized;
@@ -183,6 +245,52 @@ typedef struct{
 extern "C"{
 #endif 
 
+/// @brief Set bus lock hooks for multitask access. Lock held during whole driver call (both angle register reads, read-modify-write of settings, etc.)
+/// @param handle mt6701 handler
+/// @param lock Take lock, must be recursive (driver calls can be nested), NULL - no locking
+/// @param unlock Release lock
+/// @param lock_object Passed to hooks, use same object for all handlers on one bus
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_lock_set( mt6701_handle_t *handle, void (*lock)( void *obj ), void (*unlock)( void *obj ), void *lock_object );
+
+/// @brief Take bus lock (if hooks set), to make several driver calls atomic. Calls can be nested
+/// @param handle mt6701 handler
+void mt6701_bus_lock( mt6701_handle_t *handle );
+
+/// @brief Release bus lock taken with mt6701_bus_lock
+/// @param handle mt6701 handler
+void mt6701_bus_unlock( mt6701_handle_t *handle );
+
+/// @brief Set I2C retry policy. Failed transaction repeated after bus recovery (if i2c_recover set) and backoff delay (if delay_us set)
+/// @param handle mt6701 handler
+/// @param retries Retries count after first failed attempt, 0 - disabled
+/// @param backoff_us First retry delay in us, doubled on every next retry up to MT6701_I2C_BACKOFF_MAX_US
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_i2c_retry_set( mt6701_handle_t *handle, uint8_t retries, uint16_t backoff_us );
+
+/// @brief Enable CRC6 check of SSI frames, frame with wrong CRC read as MT6701_ERR_IO
+/// @param handle mt6701 handler
+/// @param enable True - check
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_ssi_crc_check_set( mt6701_handle_t *handle, bool enable );
+
+/// @brief Set SSI clock with ssi_clock_set callback and store it in handler
+/// @param handle mt6701 handler
+/// @param clock Clock, Hz
+/// @return On OK return 0, MT6701_ERR_CONFIG_UNAVAILABLE if ssi_clock_set not set, else see MT6701_ERR codes
+uint8_t mt6701_ssi_clock_set( mt6701_handle_t *handle, uint32_t clock );
+
+/// @brief Find fastest reliable SSI clock. Clocks tried in ascending order, on every clock reads frames
+/// back to back, each must have valid CRC6 and angle within MT6701_SSI_TUNE_TOLERANCE of previous frame.
+/// After first failed clock, settles MT6701_SSI_TUNE_MARGIN_STEPS clocks lower. Shaft may rotate slowly
+/// @param handle mt6701 handler (SSI, ssi_clock_set required)
+/// @param clocks Clocks to try, Hz, ascending
+/// @param count Clocks count
+/// @param reads Frames checked on every clock
+/// @param clock Selected clock, can be NULL
+/// @return On OK return 0, MT6701_ERR_IO if even first clock failed (previous clock restored), else see MT6701_ERR codes
+uint8_t mt6701_ssi_clock_tune( mt6701_handle_t *handle, const uint32_t *clocks, uint8_t count, uint16_t reads, uint32_t *clock );
+
 /// @brief Enable -a-b-z UVW mode (only for QFN package)
 /// @param handle mt6701 handler
 /// @param nanbnz_enable 
@@ -225,6 +333,22 @@ uint8_t mt6701_zero_set_raw( mt6701_handle_t *handle, uint16_t zero_angle );
 /// @return On OK return 0, else see MT6701_ERR codes
 uint8_t mt6701_zero_set( mt6701_handle_t *handle, float zero_angle );
 
+/// @brief Read zero offset in 12 bit position value
+/// @param handle mt6701 handler
+/// @param zero_angle Raw angle [0...4095]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_zero_get_raw( mt6701_handle_t *handle, uint16_t *zero_angle );
+
+/// @brief Set zero offset to current position. Averages raw readings with circular mean,
+/// adds result to current zero, writes it and verifies by re-reading position
+/// @param handle mt6701 handler
+/// @param samples Readings to average [1...4096]
+/// @param tolerance Max allowed position after zeroing, raw 14 bit units
+/// @param program True - save new zero to EEPROM with mt6701_programm_eeprom after verification
+/// @param zero_angle New raw zero [0...4095], can be NULL
+/// @return On OK return 0, MT6701_ERR_GENERAL if verification failed (old zero restored), else see MT6701_ERR codes
+uint8_t mt6701_zero_auto( mt6701_handle_t *handle, uint16_t samples, uint16_t tolerance, bool program, uint16_t *zero_angle );
+
 /// @brief Set hysteresis
 /// @param handle mt6701 handler
 /// @param hysteresis MT6701_HYST_x, where x can be 0_25, 0_5, 1, 2, 4, 8
@@ -240,6 +364,13 @@ uint8_t mt6701_hyst_set( mt6701_handle_t *handle, mt6701_hyst_t hysteresis );
 /// @return On OK return 0, else see MT6701_ERR codes
 uint8_t mt6701_read_raw( mt6701_handle_t *handle, uint16_t *angle_raw, mt6701_status_t *field_status, bool *button_pushed, bool *track_loss );
 
+/// @brief Read raw position and packed status in one transaction. Status bits read only with SSI interface,
+/// MT6701_SAMPLE_STATUS_VALID set if status bits valid
+/// @param handle mt6701 handler
+/// @param sample Sample with raw angle [0...16383] and MT6701_SAMPLE_x status bits
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_read_sample( mt6701_handle_t *handle, mt6701_sample_t *sample );
+
 /// @brief Read position value in degrees
 /// @param handle mt6701 handler
 /// @param angle Angle float [0...360.0)
@@ -260,6 +391,13 @@ uint8_t mt6701_a_start_stop_set_raw( mt6701_handle_t *handle, uint16_t start, ui
 /// @return On OK return 0, else see MT6701_ERR codes
 uint8_t mt6701_a_start_stop_set( mt6701_handle_t *handle, float start, float stop );
 
+/// @brief Convert start and stop angles to raw values, same way as mt6701_a_start_stop_set does
+/// @param start [0...360.0)
+/// @param stop [0...360.0)
+/// @param start_raw Raw start [0...4095]
+/// @param stop_raw Raw stop [0...4095]
+void mt6701_a_start_stop_to_raw( float start, float stop, uint16_t *start_raw, uint16_t *stop_raw );
+
 /// @brief Set direction
 /// @param handle mt6701 handler
 /// @param mt6701_direction_t MT6701_DIRECTION_CW or MT6701_DIRECTION_CCW
@@ -295,6 +433,40 @@ uint8_t mt6701_out_mode_set( mt6701_handle_t *handle, mt6701_out_mode_t out_mode
 /// @return On OK return 0, else see MT6701_ERR codes
 uint8_t mt6701_programm_eeprom( mt6701_handle_t *handle );
 
+/// @brief Start EEPROM programming without waiting. Chip must not be accessed for MT6701_EEPROM_PROGRAM_MS,
+/// so several chips can be programmed with one delay
+/// @param handle mt6701 handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_programm_eeprom_start( mt6701_handle_t *handle );
+
+/// @brief Read register
+/// @param handle mt6701 handler
+/// @param reg Register address
+/// @param data Register value
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_reg_read( mt6701_handle_t *handle, uint8_t reg, uint8_t *data );
+
+/// @brief Write register
+/// @param handle mt6701 handler
+/// @param reg Register address
+/// @param data Register value
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_reg_write( mt6701_handle_t *handle, uint8_t reg, uint8_t data );
+
+/// @brief Read sequential registers, in one transaction if i2c_read_burst set
+/// @param handle mt6701 handler
+/// @param reg First register address
+/// @param data Registers values
+/// @param len Registers count
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_reg_read_block( mt6701_handle_t *handle, uint8_t reg, uint8_t *data, uint8_t len );
+
+/// @brief Check that MT6701 answers on I2C: reads address register and angle, address bit must match used address. No retries
+/// @param handle Initialized mt6701 handler
+/// @param address Address handler configured for
+/// @return On OK return 0, MT6701_ERR_IO if no answer, MT6701_ERR_GENERAL if address bit mismatch (other device or not programmed address change)
+uint8_t mt6701_probe( mt6701_handle_t *handle, uint8_t address );
+
 /// @brief Change I2C address. Call mt6701_programm_eeprom after to save.
 /// After this call, handle address must be updated before any further communication.
 /// @param handle mt6701 handler
@@ -302,6 +474,12 @@ uint8_t mt6701_programm_eeprom( mt6701_handle_t *handle );
 /// @return On OK return 0, else see MT6701_ERR codes
 uint8_t mt6701_i2c_addr_alt_set( mt6701_handle_t *handle, bool use_alternate );
 
+/// @brief CRC8 (polynomial 0x07, init 0x00) for serialized data blocks
+/// @param data Data
+/// @param len Data length
+/// @return CRC8 value
+uint8_t mt6701_crc8( const uint8_t *data, uint16_t len );
+
 /// @brief Perfom init for mt6701. Before call interface MUST be selected and selected interface handlers MUST be defined, plus delay handler MUST be set
 /// @param handle mt6701 handler
 /// @return On OK return 0, else see MT6701_ERR codes
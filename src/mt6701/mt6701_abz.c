@@ -0,0 +1,163 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_abz.h"
+#include <stdlib.h>
+
+#define MT6701_ABZ_ILLEGAL					2
+
+// Index: (old AB << 2) | new AB, where AB = (A << 1) | B. A leads B - count up
+static const int8_t MT6701_ISR_DATA mt6701_abz_transition[16] = {
+	 0, -1, +1, MT6701_ABZ_ILLEGAL,
+	+1,  0, MT6701_ABZ_ILLEGAL, -1,
+	-1, MT6701_ABZ_ILLEGAL,  0, +1,
+	MT6701_ABZ_ILLEGAL, +1, -1,  0,
+};
+
+uint8_t mt6701_abz_init( mt6701_abz_t *abz, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width ){
+	if(abz == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((pulses_per_round == 0) || (pulses_per_round > 1024)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if(z_pulse_width > MT6701_PULSE_WIDTH_180){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	abz->count = 0;
+	abz->index_error = 0;
+	abz->errors = 0;
+	abz->counts_per_round = pulses_per_round * 4;
+	abz->hw_last = 0;
+	abz->state = 0;
+	abz->direction = 1;
+	abz->z_pulse_width = z_pulse_width;
+	abz->z_last = false;
+	abz->indexed = false;
+
+	return MT6701_OK;
+}
+
+void mt6701_abz_state_set( mt6701_abz_t *abz, bool a, bool b, bool z ){
+	abz->state = (uint8_t)((a ? 2 : 0) | (b ? 1 : 0));
+	abz->z_last = z;
+}
+
+void MT6701_ISR_ATTR mt6701_abz_edge( mt6701_abz_t *abz, bool a, bool b ){
+	uint8_t state;
+	int8_t step;
+
+	state = (uint8_t)((a ? 2 : 0) | (b ? 1 : 0));
+	step = mt6701_abz_transition[(abz->state << 2) | state];
+	abz->state = state;
+
+	if(step == MT6701_ABZ_ILLEGAL){
+		abz->errors++;
+	}else if(step != 0){
+		abz->count += step;
+		abz->direction = step;
+	}
+}
+
+void MT6701_ISR_ATTR mt6701_abz_index( mt6701_abz_t *abz, bool z ){
+	int32_t count;
+	int32_t target;
+	int32_t turn;
+	int32_t half;
+	bool rising;
+
+	if(z == abz->z_last){
+		return;
+	}
+	abz->z_last = z;
+	rising = z;
+
+	turn = abz->counts_per_round;
+	half = turn / 2;
+	count = abz->count;
+
+	// Z pulse starts at zero position: rising edge forward, falling edge backward.
+	// With 180 deg pulse opposite edges mark half turn position.
+	if(rising == (abz->direction > 0)){
+		target = 0;
+	}else if(abz->z_pulse_width == MT6701_PULSE_WIDTH_180){
+		target = half;
+	}else{
+		return;
+	}
+
+	// Nearest count equal to target modulo turn
+	count -= target;
+	if(count >= 0){
+		count = ((count + half) / turn) * turn;
+	}else{
+		count = -(((-count + half - 1) / turn) * turn);
+	}
+	count += target;
+
+	if(abz->indexed){
+		abz->index_error = abz->count - count;
+	}
+	abz->count = count;
+	abz->indexed = true;
+}
+
+void MT6701_ISR_ATTR mt6701_abz_counter_update( mt6701_abz_t *abz, uint16_t hw_count ){
+	int16_t delta;
+
+	delta = (int16_t)(hw_count - abz->hw_last);
+	abz->hw_last = hw_count;
+	abz->count += delta;
+	if(delta > 0){
+		abz->direction = 1;
+	}else if(delta < 0){
+		abz->direction = -1;
+	}
+}
+
+int32_t mt6701_abz_turns( const mt6701_abz_t *abz, int32_t count ){
+	int32_t turn = abz->counts_per_round;
+
+	if(count >= 0){
+		return count / turn;
+	}
+	return -((-count + turn - 1) / turn);
+}
+
+uint16_t mt6701_abz_angle_raw( const mt6701_abz_t *abz, int32_t count ){
+	int32_t turn = abz->counts_per_round;
+
+	count %= turn;
+	if(count < 0){
+		count += turn;
+	}
+
+	return (uint16_t)(((uint32_t)count * 16384UL) / (uint32_t)turn);
+}
@@ -0,0 +1,98 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ABZ_H__
+#define MT6701_ABZ_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+typedef struct{
+	volatile int32_t count;
+	volatile int32_t index_error;
+	volatile uint16_t errors;
+	uint16_t counts_per_round;
+	uint16_t hw_last;
+	uint8_t state;
+	int8_t direction;
+	mt6701_pulse_width_t z_pulse_width;
+	bool z_last;
+	volatile bool indexed;
+} mt6701_abz_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init quadrature decoder, settings must be same as in mt6701_abz_pulse_per_round_set and mt6701_pulse_width_set
+/// @param abz ABZ decoder handler
+/// @param pulses_per_round Pulses per round [1...1024], 4 counts per pulse
+/// @param z_pulse_width Z pulse width, with MT6701_PULSE_WIDTH_180 both Z edges used as index
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_abz_init( mt6701_abz_t *abz, uint16_t pulses_per_round, mt6701_pulse_width_t z_pulse_width );
+
+/// @brief Set current A and B state without counting (call once after init, before edges)
+/// @param abz ABZ decoder handler
+/// @param a A line level
+/// @param b B line level
+/// @param z Z line level
+void mt6701_abz_state_set( mt6701_abz_t *abz, bool a, bool b, bool z );
+
+/// @brief Process A or B edge (pin change backend). Call from ISR on any A or B change
+/// @param abz ABZ decoder handler
+/// @param a A line level
+/// @param b B line level
+void mt6701_abz_edge( mt6701_abz_t *abz, bool a, bool b );
+
+/// @brief Process Z change. Snap count to index position and store correction in index_error
+/// @param abz ABZ decoder handler
+/// @param z Z line level
+void mt6701_abz_index( mt6701_abz_t *abz, bool z );
+
+/// @brief Process hardware counter value (timer encoder backend). Call at least once per 32767 counts
+/// @param abz ABZ decoder handler
+/// @param hw_count Free running 16 bit quadrature counter value
+void mt6701_abz_counter_update( mt6701_abz_t *abz, uint16_t hw_count );
+
+/// @brief Get count of whole turns
+/// @param count Count value from decoder
+/// @param abz ABZ decoder handler
+/// @return Turns, rounded to minus infinity
+int32_t mt6701_abz_turns( const mt6701_abz_t *abz, int32_t count );
+
+/// @brief Get position inside turn in raw sensor units
+/// @param abz ABZ decoder handler
+/// @param count Count value from decoder
+/// @return Raw angle [0...16383]
+uint16_t mt6701_abz_angle_raw( const mt6701_abz_t *abz, int32_t count );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_ABZ_H__
@@ -0,0 +1,114 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_analog.h"
+#include <stdlib.h>
+
+uint8_t mt6701_analog_init( mt6701_analog_t *analog, uint8_t adc_bits, uint8_t oversample_bits, uint16_t start_raw, uint16_t stop_raw ){
+	uint8_t extra_bits;
+
+	if(analog == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((adc_bits < 8) || (adc_bits > 16) || (oversample_bits > 8)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((start_raw >= 4096) || (stop_raw >= 4096)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	extra_bits = oversample_bits / 2;
+	if(adc_bits + extra_bits > 16){
+		extra_bits = 16 - adc_bits;
+	}
+	analog->value_bits = adc_bits + extra_bits;
+	analog->shift = oversample_bits - extra_bits;
+
+	analog->sum = 0;
+	analog->count = 0;
+	analog->start = start_raw;
+	// Window can cross zero, start == stop - full turn
+	analog->span = (uint16_t)((stop_raw - start_raw) & 0x0FFF);
+	if(analog->span == 0){
+		analog->span = 4096;
+	}
+	analog->value_min = 0;
+	analog->value_max = (uint16_t)((1UL << analog->value_bits) - 1);
+	analog->value = 0;
+	analog->oversample_bits = oversample_bits;
+	analog->ready = false;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_analog_calibrate( mt6701_analog_t *analog, uint16_t value_min, uint16_t value_max ){
+	if(analog == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(value_min >= value_max){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	analog->value_min = value_min;
+	analog->value_max = value_max;
+
+	return MT6701_OK;
+}
+
+bool mt6701_analog_sample( mt6701_analog_t *analog, uint16_t sample ){
+	analog->sum += sample;
+	analog->count++;
+	if(analog->count < (1U << analog->oversample_bits)){
+		return false;
+	}
+
+	// Sum has adc_bits + oversample_bits, keep value_bits
+	analog->value = (uint16_t)(analog->sum >> analog->shift);
+	analog->sum = 0;
+	analog->count = 0;
+	analog->ready = true;
+
+	return true;
+}
+
+uint16_t mt6701_analog_angle_raw( const mt6701_analog_t *analog, uint16_t value ){
+	uint32_t offset;
+
+	if(value <= analog->value_min){
+		return analog->start;
+	}
+	if(value >= analog->value_max){
+		value = analog->value_max;
+	}
+
+	offset = ((uint32_t)(value - analog->value_min) * analog->span + (analog->value_max - analog->value_min) / 2) / (analog->value_max - analog->value_min);
+
+	return (uint16_t)((analog->start + offset) & 0x0FFF);
+}
@@ -0,0 +1,86 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ANALOG_H__
+#define MT6701_ANALOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+typedef struct{
+	uint32_t sum;
+	uint16_t count;
+	uint16_t start;
+	uint16_t span;
+	uint16_t value_min;
+	uint16_t value_max;
+	volatile uint16_t value;
+	uint8_t oversample_bits;
+	uint8_t value_bits;
+	uint8_t shift;
+	volatile bool ready;
+} mt6701_analog_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init analog output decoder, window must be same as in mt6701_a_start_stop_set_raw.
+/// Averaging 4^n samples gives n extra bits, rest of oversampling used for noise averaging
+/// @param analog Analog decoder handler
+/// @param adc_bits ADC resolution [8...16]
+/// @param oversample_bits Samples per value, 2^oversample_bits [0...8]
+/// @param start_raw Raw start [0...4095]
+/// @param stop_raw Raw stop [0...4095]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_analog_init( mt6701_analog_t *analog, uint8_t adc_bits, uint8_t oversample_bits, uint16_t start_raw, uint16_t stop_raw );
+
+/// @brief Set decimated values at start and stop angles, if chip output or ADC isnt rail to rail
+/// @param analog Analog decoder handler
+/// @param value_min Value at start angle
+/// @param value_max Value at stop angle
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_analog_calibrate( mt6701_analog_t *analog, uint16_t value_min, uint16_t value_max );
+
+/// @brief Add ADC sample, can be called from ADC ISR
+/// @param analog Analog decoder handler
+/// @param sample ADC sample
+/// @return True if new decimated value ready
+bool mt6701_analog_sample( mt6701_analog_t *analog, uint16_t sample );
+
+/// @brief Convert decimated value to angle
+/// @param analog Analog decoder handler
+/// @param value Decimated value
+/// @return Raw angle [0...4095]
+uint16_t mt6701_analog_angle_raw( const mt6701_analog_t *analog, uint16_t value );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_ANALOG_H__
@@ -0,0 +1,134 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_array.h"
+#include <stddef.h>
+
+uint8_t mt6701_array_init( mt6701_array_t *array, mt6701_handle_t *bus, void (*select)( void *obj, uint8_t id ), void *select_object,
+	uint8_t *ids, uint16_t *angles, uint8_t *status, uint8_t *errors, uint8_t capacity ){
+	if((array == NULL) || (bus == NULL) || (select == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((ids == NULL) || (angles == NULL) || (status == NULL) || (errors == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	array->bus = bus;
+	array->select = select;
+	array->select_object = select_object;
+	array->ids = ids;
+	array->angles = angles;
+	array->status = status;
+	array->errors = errors;
+	array->count = 0;
+	array->capacity = capacity;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_array_add( mt6701_array_t *array, uint8_t id, uint8_t *index ){
+	uint8_t i;
+
+	if(array == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(array->count >= array->capacity){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	i = array->count++;
+	array->ids[i] = id;
+	array->angles[i] = 0;
+	array->status[i] = MT6701_ARRAY_STALE;
+	array->errors[i] = 0;
+
+	if(index != NULL){
+		*index = i;
+	}
+
+	return MT6701_OK;
+}
+
+// Bus lock held by caller, select and read must not be interleaved with other users of bus
+static uint8_t mt6701_array_read_locked( mt6701_array_t *array, uint8_t index ){
+	mt6701_sample_t sample;
+	uint8_t res;
+
+	array->select(array->select_object, array->ids[index]);
+	res = mt6701_read_sample(array->bus, &sample);
+	if(res != MT6701_OK){
+		array->status[index] |= MT6701_ARRAY_STALE;
+		if(array->errors[index] != 0xFF){
+			array->errors[index]++;
+		}
+		return res;
+	}
+
+	array->angles[index] = sample.angle_raw;
+	array->status[index] = sample.status;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_array_read( mt6701_array_t *array, uint8_t index ){
+	uint8_t res;
+
+	if(array == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(index >= array->count){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	mt6701_bus_lock(array->bus);
+	res = mt6701_array_read_locked(array, index);
+	mt6701_bus_unlock(array->bus);
+
+	return res;
+}
+
+uint8_t mt6701_array_read_all( mt6701_array_t *array ){
+	uint8_t failed = 0;
+	uint8_t i;
+
+	if(array == NULL){
+		return 0;
+	}
+
+	mt6701_bus_lock(array->bus);
+	for(i = 0; i < array->count; i++){
+		if(mt6701_array_read_locked(array, i) != MT6701_OK){
+			failed++;
+		}
+	}
+	mt6701_bus_unlock(array->bus);
+
+	return failed;
+}
@@ -0,0 +1,100 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_ARRAY_H__
+#define MT6701_ARRAY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Status bit: last read failed, angle and other status bits from previous successful read
+#define MT6701_ARRAY_STALE					0x80
+
+// Parallel arrays for mt6701_array_init, 5 bytes per encoder
+#define MT6701_ARRAY_STORAGE(name, capacity) \
+	static uint8_t name##_ids[capacity]; \
+	static uint16_t name##_angles[capacity]; \
+	static uint8_t name##_status[capacity]; \
+	static uint8_t name##_errors[capacity]
+
+#define MT6701_ARRAY_BUFFERS(name) \
+	name##_ids, name##_angles, name##_status, name##_errors, (uint8_t)sizeof(name##_ids)
+
+typedef struct{
+	mt6701_handle_t *bus;				// Shared by all encoders, initialized
+	void (*select)( void *obj, uint8_t id );	// Point bus to encoder: set I2C address, CS pin, mux channel
+	void *select_object;
+	uint8_t *ids;						// Address/CS pin/user id
+	uint16_t *angles;					// Latest raw angle [0...16383]
+	uint8_t *status;					// Latest MT6701_SAMPLE_x bits, MT6701_ARRAY_STALE
+	uint8_t *errors;					// Failed reads, saturated at 255
+	uint8_t count;
+	uint8_t capacity;
+} mt6701_array_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init empty container over shared bus. Per encoder data stored in user arrays (see MT6701_ARRAY_STORAGE)
+/// @param array Container
+/// @param bus mt6701 handler, callbacks shared by all encoders, must be initialized before reads
+/// @param select Called before every encoder access with encoder id
+/// @param select_object Passed to select
+/// @param ids Ids array
+/// @param angles Angles array
+/// @param status Status array
+/// @param errors Errors array
+/// @param capacity Length of every array
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_array_init( mt6701_array_t *array, mt6701_handle_t *bus, void (*select)( void *obj, uint8_t id ), void *select_object,
+	uint8_t *ids, uint16_t *angles, uint8_t *status, uint8_t *errors, uint8_t capacity );
+
+/// @brief Add encoder
+/// @param array Container
+/// @param id Passed to select callback (I2C address, CS pin, etc.)
+/// @param index Index of added encoder, can be NULL
+/// @return On OK return 0, MT6701_ERR_OUT_OF_RANGE if container full, else see MT6701_ERR codes
+uint8_t mt6701_array_add( mt6701_array_t *array, uint8_t id, uint8_t *index );
+
+/// @brief Read one encoder
+/// @param array Container
+/// @param index Encoder index
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_array_read( mt6701_array_t *array, uint8_t index );
+
+/// @brief Read all encoders in one bus lock. Failed encoders marked with MT6701_ARRAY_STALE, others still read
+/// @param array Container
+/// @return Failed encoders count
+uint8_t mt6701_array_read_all( mt6701_array_t *array );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_ARRAY_H__
@@ -0,0 +1,121 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_change.h"
+#include <stdlib.h>
+
+uint8_t mt6701_change_init( mt6701_change_t *change, uint16_t deadband, uint16_t heartbeat, mt6701_change_callback_t callback, void *context ){
+	if(change == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(deadband >= 8192){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	change->callback = callback;
+	change->context = context;
+	change->deadband = deadband;
+	change->heartbeat = heartbeat;
+	change->idle = 0;
+	change->last = 0;
+	change->seq = 0;
+	change->taken = 0;
+	change->primed = false;
+
+	return MT6701_OK;
+}
+
+bool mt6701_change_update( mt6701_change_t *change, uint16_t angle_raw ){
+	int16_t delta;
+	mt6701_seq_t seq;
+
+	angle_raw &= 0x3FFF;
+
+	if(change->primed){
+		delta = (int16_t)((uint16_t)(angle_raw - change->last) << 2) >> 2;
+		if((uint16_t)abs(delta) <= change->deadband){
+			change->idle++;
+			if((change->heartbeat == 0) || (change->idle < change->heartbeat)){
+				return false;
+			}
+			// Heartbeat repeats last reported value, so drift inside deadband not accumulated
+			angle_raw = change->last;
+		}
+	}
+
+	change->primed = true;
+	change->idle = 0;
+
+	seq = change->seq;
+	change->seq = (mt6701_seq_t)(seq + 1);
+	MT6701_BARRIER();
+	change->last = angle_raw;
+	MT6701_BARRIER();
+	change->seq = (mt6701_seq_t)(seq + 2);
+
+	if(change->callback != NULL){
+		change->callback(change->context, angle_raw);
+	}
+
+	return true;
+}
+
+bool mt6701_change_take( mt6701_change_t *change, uint16_t *angle_raw ){
+	mt6701_seq_t seq_begin;
+	mt6701_seq_t seq_end;
+	uint16_t last;
+	uint8_t attempt;
+
+	for(attempt = 0; attempt < MT6701_SLOT_RETRIES; attempt++){
+		seq_begin = change->seq;
+		MT6701_BARRIER();
+		if(seq_begin & 1){
+			continue;
+		}
+
+		last = change->last;
+
+		MT6701_BARRIER();
+		seq_end = change->seq;
+		if(seq_begin != seq_end){
+			continue;
+		}
+
+		if(seq_begin == change->taken){
+			return false;
+		}
+		change->taken = seq_begin;
+		if(angle_raw != NULL){
+			*angle_raw = last;
+		}
+		return true;
+	}
+
+	// Writer keeps interrupting, report stays pending for next call
+	return false;
+}
@@ -0,0 +1,80 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_CHANGE_H__
+#define MT6701_CHANGE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+#include "mt6701_slot.h"
+
+typedef void (*mt6701_change_callback_t)( void *context, uint16_t angle_raw );
+
+typedef struct{
+	mt6701_change_callback_t callback;
+	void *context;
+	uint16_t deadband;
+	uint16_t heartbeat;
+	uint16_t idle;
+	volatile uint16_t last;
+	volatile mt6701_seq_t seq;		// Odd while report in progress, +2 per report
+	mt6701_seq_t taken;				// Sequence seen by last mt6701_change_take
+	bool primed;
+} mt6701_change_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init change detector. Deadband applied to reported value on MCU side and independent from chip hysteresis (mt6701_hyst_set)
+/// @param change Change detector handler
+/// @param deadband Min movement from last reported value in raw units [0...8191], 0 - report any change
+/// @param heartbeat Report unchanged value after this count of samples, 0 - disabled
+/// @param callback Called on every report, can be NULL (only flag set)
+/// @param context Passed to callback
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_change_init( mt6701_change_t *change, uint16_t deadband, uint16_t heartbeat, mt6701_change_callback_t callback, void *context );
+
+/// @brief Compare new sample with last reported value. First sample always reported
+/// @param change Change detector handler
+/// @param angle_raw Raw angle [0...16383]
+/// @return True if sample reported
+bool mt6701_change_update( mt6701_change_t *change, uint16_t angle_raw );
+
+/// @brief Check for new report and get last reported value. Safe against mt6701_change_update from ISR:
+/// value and sequence copied consistently, report landing during call returned on next call
+/// @param change Change detector handler
+/// @param angle_raw Last reported raw angle, can be NULL
+/// @return True if value reported since last call
+bool mt6701_change_take( mt6701_change_t *change, uint16_t *angle_raw );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_CHANGE_H__
@@ -0,0 +1,179 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_diag.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MT6701_DIAG_ANGLE_PENDING			0xFF
+
+uint8_t mt6701_diag_start( mt6701_diag_t *diag ){
+	if(diag == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	memset(diag, 0, sizeof(mt6701_diag_t));
+	diag->next = MT6701_DIAG_ANGLE_PENDING;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_diag_step( mt6701_diag_t *diag, mt6701_handle_t *handle ){
+	uint8_t angle[2];
+	uint8_t len;
+	uint8_t res;
+
+	if((diag == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(diag->complete){
+		return MT6701_OK;
+	}
+
+	if(diag->next == MT6701_DIAG_ANGLE_PENDING){
+		res = mt6701_reg_read_block(handle, MT6701_REG_ANGLE6, angle, sizeof(angle));
+		if(res != MT6701_OK){
+			return res;
+		}
+		diag->angle_raw = (uint16_t)(((uint16_t)angle[0] << 6) | ((angle[1] & MT6701_REG_ANGLE0_MASK) >> MT6701_REG_ANGLE0_POS));
+		diag->next = 0;
+		return MT6701_OK;
+	}
+
+	len = MT6701_PROFILE_REG_COUNT - diag->next;
+	if(len > MT6701_DIAG_CHUNK){
+		len = MT6701_DIAG_CHUNK;
+	}
+
+	res = mt6701_reg_read_block(handle, MT6701_PROFILE_REG_FIRST + diag->next, &diag->regs[diag->next], len);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	diag->next += len;
+	if(diag->next >= MT6701_PROFILE_REG_COUNT){
+		diag->complete = true;
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_diag_read( mt6701_diag_t *diag, mt6701_handle_t *handle ){
+	uint8_t res;
+
+	res = mt6701_diag_start(diag);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	while(!diag->complete){
+		res = mt6701_diag_step(diag, handle);
+		if(res != MT6701_OK){
+			return res;
+		}
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_diag_decode( const mt6701_diag_t *diag, mt6701_profile_t *profile ){
+	if((diag == NULL) || (profile == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(!diag->complete){
+		return MT6701_ERR_UNINITITIALIZED;
+	}
+
+	mt6701_profile_decode(diag->regs, profile);
+
+	return MT6701_OK;
+}
+
+static const char *mt6701_diag_hyst( mt6701_hyst_t hysteresis ){
+	switch(hysteresis){
+		case MT6701_HYST_0_25:	return "0.25";
+		case MT6701_HYST_0_5:	return "0.5";
+		case MT6701_HYST_1:		return "1";
+		case MT6701_HYST_2:		return "2";
+		case MT6701_HYST_4:		return "4";
+		case MT6701_HYST_8:		return "8";
+		default:				return "?";
+	}
+}
+
+static const char *mt6701_diag_pulse_width( mt6701_pulse_width_t pulse_width ){
+	switch(pulse_width){
+		case MT6701_PULSE_WIDTH_1LSB:	return "1";
+		case MT6701_PULSE_WIDTH_2LSB:	return "2";
+		case MT6701_PULSE_WIDTH_4LSB:	return "4";
+		case MT6701_PULSE_WIDTH_8LSB:	return "8";
+		case MT6701_PULSE_WIDTH_12LSB:	return "12";
+		case MT6701_PULSE_WIDTH_16LSB:	return "16";
+		case MT6701_PULSE_WIDTH_180:	return "180";
+		default:						return "?";
+	}
+}
+
+uint16_t mt6701_diag_format( const mt6701_diag_t *diag, char *text, uint16_t size ){
+	mt6701_profile_t profile;
+	int len;
+
+	if((text == NULL) || (size == 0)){
+		return 0;
+	}
+	text[0] = '\0';
+
+	if(mt6701_diag_decode(diag, &profile) != MT6701_OK){
+		return 0;
+	}
+
+	len = snprintf(text, size,
+		"angle=%u addr=0x%02X mode=%s abz=%u uvw_pp=%u nanbnz=%u dir=%s zero=%u hyst=%s pw=%s out=%s pwm=%s/%s start=%u stop=%u",
+		(unsigned)diag->angle_raw,
+		profile.i2c_alternate ? MT6701_ALTERNATE_ADDRESS : MT6701_DEFAULT_ADDRESS,
+		profile.uvw_mode ? "uvw" : "abz",
+		(unsigned)profile.abz_pulses,
+		(unsigned)profile.uvw_pole_pairs,
+		profile.nanbnz ? 1u : 0u,
+		(profile.direction == MT6701_DIRECTION_CCW) ? "ccw" : "cw",
+		(unsigned)profile.zero,
+		mt6701_diag_hyst(profile.hysteresis),
+		mt6701_diag_pulse_width(profile.pulse_width),
+		(profile.out_mode == MT6701_OUT_MODE_PWM) ? "pwm" : "analog",
+		(profile.pwm_freq == MT6701_PWM_FREQ_497_2) ? "497.2" : "994.4",
+		(profile.pwm_polarity == MT6701_PWM_POL_LOW) ? "low" : "high",
+		(unsigned)profile.a_start,
+		(unsigned)profile.a_stop);
+
+	if((len < 0) || (len >= size)){
+		return 0;
+	}
+
+	return (uint16_t)len;
+}
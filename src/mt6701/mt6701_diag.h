@@ -0,0 +1,90 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_DIAG_H__
+#define MT6701_DIAG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+#include "mt6701_profile.h"
+
+// Registers read per mt6701_diag_step() call, bounds time of one step.
+// Whole block in one step if set to MT6701_PROFILE_REG_COUNT
+#ifndef MT6701_DIAG_CHUNK
+#define MT6701_DIAG_CHUNK					MT6701_PROFILE_REG_COUNT
+#endif
+
+// Enough for mt6701_diag_format() output
+#define MT6701_DIAG_TEXT_SIZE				160
+
+typedef struct{
+	uint8_t regs[MT6701_PROFILE_REG_COUNT];	// Raw configuration block, MT6701_PROFILE_REG_FIRST...MT6701_PROFILE_REG_LAST
+	uint16_t angle_raw;
+	uint8_t next;						// Next block offset, 0xFF before angle read
+	bool complete;
+} mt6701_diag_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Start new dump
+/// @param diag Dump handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_diag_start( mt6701_diag_t *diag );
+
+/// @brief Read next part of dump: angle registers, then MT6701_DIAG_CHUNK configuration registers. One transaction with i2c_read_burst
+/// @param diag Dump handler
+/// @param handle mt6701 handler (I2C)
+/// @return On OK return 0 (check diag->complete), else see MT6701_ERR codes, failed part repeated on next call
+uint8_t mt6701_diag_step( mt6701_diag_t *diag, mt6701_handle_t *handle );
+
+/// @brief Read whole dump, 2 transactions with i2c_read_burst and default MT6701_DIAG_CHUNK
+/// @param diag Dump handler
+/// @param handle mt6701 handler (I2C)
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_diag_read( mt6701_diag_t *diag, mt6701_handle_t *handle );
+
+/// @brief Decode configuration fields of complete dump
+/// @param diag Dump handler
+/// @param profile Decoded configuration
+/// @return On OK return 0, MT6701_ERR_UNINITITIALIZED if dump not complete, else see MT6701_ERR codes
+uint8_t mt6701_diag_decode( const mt6701_diag_t *diag, mt6701_profile_t *profile );
+
+/// @brief Format complete dump as one line of key=value pairs
+/// @param diag Dump handler
+/// @param text Output string
+/// @param size Output size, MT6701_DIAG_TEXT_SIZE enough
+/// @return String length, 0 on error
+uint16_t mt6701_diag_format( const mt6701_diag_t *diag, char *text, uint16_t size );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_DIAG_H__
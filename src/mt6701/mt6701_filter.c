@@ -0,0 +1,222 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_filter.h"
+#include <stdlib.h>
+
+#define MT6701_FILTER_TURN					16384
+#define MT6701_FILTER_MASK					0x3FFF
+
+// Signed difference a - b, wrapped to half turn
+static int16_t mt6701_filter_diff( uint16_t a, uint16_t b ){
+	return (int16_t)((uint16_t)(a - b) << 2) >> 2;
+}
+
+static uint8_t mt6701_filter_add( mt6701_filter_t *filter, mt6701_filter_type_t type, uint16_t param ){
+	mt6701_filter_stage_t *stage;
+
+	if(filter == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(filter->count >= MT6701_FILTER_MAX_STAGES){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	stage = &filter->stages[filter->count++];
+	stage->type = type;
+	stage->param = param;
+	stage->count = 0;
+	stage->index = 0;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_filter_init( mt6701_filter_t *filter ){
+	if(filter == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	filter->count = 0;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_filter_add_median( mt6701_filter_t *filter, uint8_t window ){
+	if((window < 3) || (window > MT6701_FILTER_MAX_WINDOW) || ((window & 1) == 0)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return mt6701_filter_add(filter, MT6701_FILTER_MEDIAN, window);
+}
+
+uint8_t mt6701_filter_add_moving_average( mt6701_filter_t *filter, uint8_t window ){
+	if((window < 2) || (window > MT6701_FILTER_MAX_WINDOW)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return mt6701_filter_add(filter, MT6701_FILTER_MOVING_AVERAGE, window);
+}
+
+uint8_t mt6701_filter_add_iir( mt6701_filter_t *filter, uint8_t shift ){
+	if((shift < 1) || (shift > 8)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return mt6701_filter_add(filter, MT6701_FILTER_IIR, shift);
+}
+
+uint8_t mt6701_filter_add_deadband( mt6701_filter_t *filter, uint16_t band ){
+	if((band < 1) || (band >= MT6701_FILTER_TURN / 2)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return mt6701_filter_add(filter, MT6701_FILTER_DEADBAND, band);
+}
+
+void mt6701_filter_reset( mt6701_filter_t *filter ){
+	uint8_t i;
+
+	for(i = 0; i < filter->count; i++){
+		filter->stages[i].count = 0;
+		filter->stages[i].index = 0;
+	}
+}
+
+// Push sample to ring buffer, first sample fills whole window
+static void mt6701_filter_push( mt6701_filter_stage_t *stage, uint16_t value ){
+	uint8_t i;
+
+	if(stage->count == 0){
+		for(i = 0; i < stage->param; i++){
+			stage->buffer[i] = value;
+		}
+		stage->count = (uint8_t)stage->param;
+		stage->index = 0;
+	}
+
+	stage->buffer[stage->index] = value;
+	stage->index++;
+	if(stage->index >= stage->param){
+		stage->index = 0;
+	}
+}
+
+static uint16_t mt6701_filter_median( mt6701_filter_stage_t *stage, uint16_t value ){
+	int16_t sorted[MT6701_FILTER_MAX_WINDOW];
+	int16_t delta;
+	uint8_t i;
+	uint8_t j;
+
+	mt6701_filter_push(stage, value);
+
+	// Insertion sort of offsets from newest sample, window is small
+	for(i = 0; i < stage->param; i++){
+		delta = mt6701_filter_diff(stage->buffer[i], value);
+		for(j = i; (j > 0) && (sorted[j - 1] > delta); j--){
+			sorted[j] = sorted[j - 1];
+		}
+		sorted[j] = delta;
+	}
+
+	return (uint16_t)(value + sorted[stage->param / 2]) & MT6701_FILTER_MASK;
+}
+
+static uint16_t mt6701_filter_moving_average( mt6701_filter_stage_t *stage, uint16_t value ){
+	int32_t sum = 0;
+	uint8_t i;
+
+	mt6701_filter_push(stage, value);
+
+	// Offsets from newest sample
+	for(i = 0; i < stage->param; i++){
+		sum += mt6701_filter_diff(stage->buffer[i], value);
+	}
+	sum /= (int32_t)stage->param;
+
+	return (uint16_t)(value + sum) & MT6701_FILTER_MASK;
+}
+
+static uint16_t mt6701_filter_iir( mt6701_filter_stage_t *stage, uint16_t value ){
+	uint8_t shift = (uint8_t)stage->param;
+	uint32_t turn = (uint32_t)MT6701_FILTER_TURN << shift;
+	int32_t diff;
+
+	if(stage->count == 0){
+		stage->state = (uint32_t)value << shift;
+		stage->count = 1;
+		return value;
+	}
+
+	// State keeps shift extra fraction bits, difference wrapped to half turn
+	diff = (int32_t)(((uint32_t)value << shift) - stage->state);
+	diff = (int32_t)((uint32_t)diff & (turn - 1));
+	if(diff >= (int32_t)(turn / 2)){
+		diff -= (int32_t)turn;
+	}
+	stage->state = (stage->state + (uint32_t)(diff >> shift)) & (turn - 1);
+
+	return (uint16_t)(((stage->state + (1UL << (shift - 1))) >> shift) & MT6701_FILTER_MASK);
+}
+
+static uint16_t mt6701_filter_deadband( mt6701_filter_stage_t *stage, uint16_t value ){
+	if((stage->count == 0) || ((uint16_t)abs(mt6701_filter_diff(value, stage->output)) > stage->param)){
+		stage->output = value;
+		stage->count = 1;
+	}
+
+	return stage->output;
+}
+
+uint16_t mt6701_filter_update( mt6701_filter_t *filter, uint16_t angle_raw ){
+	mt6701_filter_stage_t *stage;
+	uint8_t i;
+
+	angle_raw &= MT6701_FILTER_MASK;
+
+	for(i = 0; i < filter->count; i++){
+		stage = &filter->stages[i];
+		switch(stage->type){
+			case MT6701_FILTER_MEDIAN:
+				angle_raw = mt6701_filter_median(stage, angle_raw);
+				break;
+			case MT6701_FILTER_MOVING_AVERAGE:
+				angle_raw = mt6701_filter_moving_average(stage, angle_raw);
+				break;
+			case MT6701_FILTER_IIR:
+				angle_raw = mt6701_filter_iir(stage, angle_raw);
+				break;
+			case MT6701_FILTER_DEADBAND:
+				angle_raw = mt6701_filter_deadband(stage, angle_raw);
+				break;
+			default:
+				break;
+		}
+	}
+
+	return angle_raw;
+}
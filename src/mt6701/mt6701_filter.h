@@ -0,0 +1,115 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_FILTER_H__
+#define MT6701_FILTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Stages in one filter chain
+#ifndef MT6701_FILTER_MAX_STAGES
+#define MT6701_FILTER_MAX_STAGES			4
+#endif
+
+// Max window of median and moving average stages
+#ifndef MT6701_FILTER_MAX_WINDOW
+#define MT6701_FILTER_MAX_WINDOW			8
+#endif
+
+typedef enum{
+	MT6701_FILTER_NONE,
+	MT6701_FILTER_MEDIAN,
+	MT6701_FILTER_MOVING_AVERAGE,
+	MT6701_FILTER_IIR,
+	MT6701_FILTER_DEADBAND,
+} mt6701_filter_type_t;
+
+typedef struct{
+	uint16_t buffer[MT6701_FILTER_MAX_WINDOW];
+	uint32_t state;
+	uint16_t param;
+	uint16_t output;
+	uint8_t type;
+	uint8_t index;
+	uint8_t count;
+} mt6701_filter_stage_t;
+
+typedef struct{
+	mt6701_filter_stage_t stages[MT6701_FILTER_MAX_STAGES];
+	uint8_t count;
+} mt6701_filter_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init empty filter chain (output equal input)
+/// @param filter Filter handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_filter_init( mt6701_filter_t *filter );
+
+/// @brief Add median stage to end of chain
+/// @param filter Filter handler
+/// @param window Odd window size [3...MT6701_FILTER_MAX_WINDOW]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_filter_add_median( mt6701_filter_t *filter, uint8_t window );
+
+/// @brief Add moving average stage to end of chain
+/// @param filter Filter handler
+/// @param window Window size [2...MT6701_FILTER_MAX_WINDOW]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_filter_add_moving_average( mt6701_filter_t *filter, uint8_t window );
+
+/// @brief Add first order IIR stage to end of chain: y += (x - y) / 2^shift
+/// @param filter Filter handler
+/// @param shift Smoothing [1...8]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_filter_add_iir( mt6701_filter_t *filter, uint8_t shift );
+
+/// @brief Add deadband stage to end of chain, output changes only if input moved more than band
+/// @param filter Filter handler
+/// @param band Deadband in raw units [1...8191]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_filter_add_deadband( mt6701_filter_t *filter, uint16_t band );
+
+/// @brief Reset state of all stages, next sample primes chain
+/// @param filter Filter handler
+void mt6701_filter_reset( mt6701_filter_t *filter );
+
+/// @brief Process raw sample through chain, wrap at 0/16383 handled by every stage. Can be called from ISR
+/// @param filter Filter handler
+/// @param angle_raw Raw angle [0...16383]
+/// @return Filtered raw angle [0...16383]
+uint16_t mt6701_filter_update( mt6701_filter_t *filter, uint16_t angle_raw );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_FILTER_H__
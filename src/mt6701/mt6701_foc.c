@@ -0,0 +1,215 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_foc.h"
+#include "mt6701.h"
+#include <stdlib.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define MT6701_FOC_LUT_ATTR					PROGMEM
+#define MT6701_FOC_LUT_READ(i)				((int16_t)pgm_read_word(&mt6701_foc_sin_lut[(i)]))
+#else
+#define MT6701_FOC_LUT_ATTR
+#define MT6701_FOC_LUT_READ(i)				(mt6701_foc_sin_lut[(i)])
+#endif
+
+#define MT6701_FOC_QUARTER					0x4000
+#define MT6701_FOC_LUT_SHIFT				(14 - MT6701_FOC_LUT_BITS)
+#define MT6701_FOC_LUT_FRAC_MASK			((1 << MT6701_FOC_LUT_SHIFT) - 1)
+
+// sin(i * pi/2 / N) * 32767, i = 0...N
+#if MT6701_FOC_LUT_BITS == 5
+static const int16_t mt6701_foc_sin_lut[32+1] MT6701_FOC_LUT_ATTR = {
+	    0,  1608,  3212,  4808,  6393,  7962,  9512, 11039,
+	12539, 14010, 15446, 16846, 18204, 19519, 20787, 22005,
+	23170, 24279, 25329, 26319, 27245, 28105, 28898, 29621,
+	30273, 30852, 31356, 31785, 32137, 32412, 32609, 32728,
+	32767,
+};
+#elif MT6701_FOC_LUT_BITS == 6
+static const int16_t mt6701_foc_sin_lut[64+1] MT6701_FOC_LUT_ATTR = {
+	    0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+	 6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767,
+};
+#elif MT6701_FOC_LUT_BITS == 7
+static const int16_t mt6701_foc_sin_lut[128+1] MT6701_FOC_LUT_ATTR = {
+	    0,   402,   804,  1206,  1608,  2009,  2410,  2811,
+	 3212,  3612,  4011,  4410,  4808,  5205,  5602,  5998,
+	 6393,  6786,  7179,  7571,  7962,  8351,  8739,  9126,
+	 9512,  9896, 10278, 10659, 11039, 11417, 11793, 12167,
+	12539, 12910, 13279, 13645, 14010, 14372, 14732, 15090,
+	15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+	18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475,
+	20787, 21096, 21403, 21705, 22005, 22301, 22594, 22884,
+	23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072,
+	25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019,
+	27245, 27466, 27683, 27896, 28105, 28310, 28510, 28706,
+	28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+	30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237,
+	31356, 31470, 31580, 31685, 31785, 31880, 31971, 32057,
+	32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+	32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765,
+	32767,
+};
+#elif MT6701_FOC_LUT_BITS == 8
+static const int16_t mt6701_foc_sin_lut[256+1] MT6701_FOC_LUT_ATTR = {
+	    0,   201,   402,   603,   804,  1005,  1206,  1407,
+	 1608,  1809,  2009,  2210,  2410,  2611,  2811,  3012,
+	 3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,
+	 4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,
+	 6393,  6590,  6786,  6983,  7179,  7375,  7571,  7767,
+	 7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+	 9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849,
+	11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353,
+	12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+	14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+	15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673,
+	16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+	18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357,
+	19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+	20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+	22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+	23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143,
+	24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+	25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198,
+	26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+	27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+	28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803,
+	28898, 28992, 29085, 29177, 29268, 29358, 29447, 29534,
+	29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+	30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+	30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+	31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+	31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+	32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382,
+	32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+	32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717,
+	32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766,
+	32767,
+};
+#else
+#error "MT6701_FOC_LUT_BITS must be in range 5...8"
+#endif
+
+// Sinus of first quarter, position [0...0x4000]
+static int16_t mt6701_foc_quarter_sin( uint16_t position ){
+	uint16_t index;
+	uint16_t frac;
+	int16_t value;
+	int16_t next;
+
+	index = position >> MT6701_FOC_LUT_SHIFT;
+	frac  = position & MT6701_FOC_LUT_FRAC_MASK;
+
+	value = MT6701_FOC_LUT_READ(index);
+	if(frac != 0){
+		next = MT6701_FOC_LUT_READ(index + 1);
+		value += (int16_t)(((int32_t)(next - value) * frac) >> MT6701_FOC_LUT_SHIFT);
+	}
+
+	return value;
+}
+
+static int16_t mt6701_foc_sin( uint16_t angle ){
+	uint16_t position;
+
+	position = angle & (MT6701_FOC_QUARTER - 1);
+
+	switch(angle >> 14){
+		case 0: return  mt6701_foc_quarter_sin(position);
+		case 1: return  mt6701_foc_quarter_sin(MT6701_FOC_QUARTER - position);
+		case 2: return -mt6701_foc_quarter_sin(position);
+		default: return -mt6701_foc_quarter_sin(MT6701_FOC_QUARTER - position);
+	}
+}
+
+uint8_t mt6701_foc_init( mt6701_foc_t *foc, uint8_t pole_pairs, uint16_t electrical_offset ){
+	if(foc == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(pole_pairs == 0){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	foc->pole_pairs = pole_pairs;
+	foc->offset = electrical_offset;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_foc_align( mt6701_foc_t *foc, uint16_t angle_raw ){
+	if(foc == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(angle_raw >= 16384){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	foc->offset = 0;
+	foc->offset = mt6701_foc_electrical_angle(foc, angle_raw);
+
+	return MT6701_OK;
+}
+
+uint16_t mt6701_foc_electrical_angle( const mt6701_foc_t *foc, uint16_t angle_raw ){
+	uint16_t electrical;
+
+	// 14 bit mechanical angle to 16 bit turn, wrap at 65536 gives modulo of electrical turn
+	electrical = (uint16_t)((uint16_t)(angle_raw << 2) * (uint16_t)foc->pole_pairs);
+	electrical -= foc->offset;
+
+	return electrical;
+}
+
+void mt6701_foc_sin_cos( uint16_t electrical_angle, int16_t *sin_q15, int16_t *cos_q15 ){
+	if(sin_q15 != NULL){
+		*sin_q15 = mt6701_foc_sin(electrical_angle);
+	}
+
+	if(cos_q15 != NULL){
+		*cos_q15 = mt6701_foc_sin((uint16_t)(electrical_angle + MT6701_FOC_QUARTER));
+	}
+}
+
+uint16_t mt6701_foc_update( const mt6701_foc_t *foc, uint16_t angle_raw, int16_t *sin_q15, int16_t *cos_q15 ){
+	uint16_t electrical;
+
+	electrical = mt6701_foc_electrical_angle(foc, angle_raw);
+	mt6701_foc_sin_cos(electrical, sin_q15, cos_q15);
+
+	return electrical;
+}
@@ -0,0 +1,89 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_FOC_H__
+#define MT6701_FOC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Quarter wave sin table size is 2^MT6701_FOC_LUT_BITS entries (5...8).
+// Table stored in flash, 6 bits give ~1e-4 max error after interpolation.
+#ifndef MT6701_FOC_LUT_BITS
+#define MT6701_FOC_LUT_BITS					6
+#endif
+
+// Electrical angle is 16 bit value, 65536 - one full electrical turn
+#define MT6701_FOC_TURN						65536UL
+
+typedef struct{
+	uint16_t offset;
+	uint8_t pole_pairs;
+} mt6701_foc_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init FOC helper
+/// @param foc FOC helper handler
+/// @param pole_pairs Motor pole pairs [1...255]
+/// @param electrical_offset Electrical angle of rotor d axis at raw angle 0 [0...65535]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_foc_init( mt6701_foc_t *foc, uint8_t pole_pairs, uint16_t electrical_offset );
+
+/// @brief Set electrical offset so, that current rotor position become electrical zero
+/// @param foc FOC helper handler
+/// @param angle_raw Raw angle [0...16383], read while rotor locked on d axis
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_foc_align( mt6701_foc_t *foc, uint16_t angle_raw );
+
+/// @brief Convert raw angle to electrical angle
+/// @param foc FOC helper handler
+/// @param angle_raw Raw angle [0...16383]
+/// @return Electrical angle [0...65535]
+uint16_t mt6701_foc_electrical_angle( const mt6701_foc_t *foc, uint16_t angle_raw );
+
+/// @brief Get sin and cos of electrical angle from interpolated lookup table. Pointer can be NULL
+/// @param electrical_angle Electrical angle [0...65535]
+/// @param sin_q15 Sinus in Q15 format [-32767...32767]
+/// @param cos_q15 Cosinus in Q15 format [-32767...32767]
+void mt6701_foc_sin_cos( uint16_t electrical_angle, int16_t *sin_q15, int16_t *cos_q15 );
+
+/// @brief Convert raw angle to electrical angle and get it sin and cos
+/// @param foc FOC helper handler
+/// @param angle_raw Raw angle [0...16383]
+/// @param sin_q15 Sinus in Q15 format [-32767...32767]
+/// @param cos_q15 Cosinus in Q15 format [-32767...32767]
+/// @return Electrical angle [0...65535]
+uint16_t mt6701_foc_update( const mt6701_foc_t *foc, uint16_t angle_raw, int16_t *sin_q15, int16_t *cos_q15 );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_FOC_H__
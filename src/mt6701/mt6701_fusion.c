@@ -0,0 +1,135 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_fusion.h"
+#include <stdlib.h>
+
+uint8_t mt6701_fusion_init( mt6701_fusion_t *fusion, const mt6701_abz_t *abz, uint16_t error_limit ){
+	if((fusion == NULL) || (abz == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(abz->counts_per_round == 0){
+		return MT6701_ERR_UNINITITIALIZED;
+	}
+
+	if(error_limit >= 8192){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	fusion->abz = abz;
+	fusion->count_offset = 0;
+	fusion->error_limit = error_limit;
+	fusion->synced = false;
+	mt6701_fusion_health_reset(fusion);
+
+	return MT6701_OK;
+}
+
+void mt6701_fusion_health_reset( mt6701_fusion_t *fusion ){
+	fusion->last_error = 0;
+	fusion->max_error = 0;
+	fusion->faults = 0;
+	fusion->corrections = 0;
+}
+
+uint8_t mt6701_fusion_correct( mt6701_fusion_t *fusion, uint16_t angle_raw, int32_t count ){
+	int32_t cpr;
+	int16_t error;
+	int32_t error_counts;
+	uint16_t error_abs;
+
+	if(fusion == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(angle_raw >= 16384){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	cpr = fusion->abz->counts_per_round;
+
+	// Signed discrepancy in raw units, wrapped to half turn
+	error  = (int16_t)(mt6701_fusion_angle_raw(fusion, count) - angle_raw);
+	error  = (int16_t)(error << 2) >> 2;
+
+	// Rounded to nearest count
+	if(error >= 0){
+		error_counts = ((int32_t)error * cpr + 8192) >> 14;
+	}else{
+		error_counts = -((((int32_t)-error) * cpr + 8192) >> 14);
+	}
+	fusion->count_offset -= error_counts;
+
+	if(!fusion->synced){
+		fusion->synced = true;
+		return MT6701_OK;
+	}
+
+	error_abs = (uint16_t)abs(error);
+	fusion->last_error = error;
+	fusion->corrections++;
+	if(error_abs > fusion->max_error){
+		fusion->max_error = error_abs;
+	}
+
+	if(error_abs > fusion->error_limit){
+		fusion->faults++;
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_fusion_update( mt6701_fusion_t *fusion, mt6701_handle_t *handle, int32_t (*count_read)( void *obj ), void *obj ){
+	uint8_t res;
+	int32_t count_before;
+	int32_t count_after;
+	uint16_t angle_raw;
+
+	if((fusion == NULL) || (count_read == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	count_before = count_read(obj);
+	res = mt6701_read_raw(handle, &angle_raw, NULL, NULL, NULL);
+	count_after = count_read(obj);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	return mt6701_fusion_correct(fusion, angle_raw, count_before + (count_after - count_before) / 2);
+}
+
+int32_t mt6701_fusion_position( const mt6701_fusion_t *fusion, int32_t count ){
+	count += fusion->count_offset;
+	return mt6701_abz_turns(fusion->abz, count) * 16384L + mt6701_abz_angle_raw(fusion->abz, count);
+}
+
+uint16_t mt6701_fusion_angle_raw( const mt6701_fusion_t *fusion, int32_t count ){
+	return mt6701_abz_angle_raw(fusion->abz, count + fusion->count_offset);
+}
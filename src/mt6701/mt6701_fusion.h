@@ -0,0 +1,94 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_FUSION_H__
+#define MT6701_FUSION_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+#include "mt6701_abz.h"
+
+typedef struct{
+	const mt6701_abz_t *abz;
+	int32_t count_offset;
+	int16_t last_error;
+	uint16_t max_error;
+	uint16_t error_limit;
+	uint16_t faults;
+	uint32_t corrections;
+	bool synced;
+} mt6701_fusion_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init absolute + incremental position fusion. Decoder must be initialized with same pulses per round as chip ABZ output
+/// @param fusion Fusion handler
+/// @param abz ABZ decoder, which counts chip A/B outputs
+/// @param error_limit Discrepancy in raw units [0...8191], above which correction counted as fault
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_fusion_init( mt6701_fusion_t *fusion, const mt6701_abz_t *abz, uint16_t error_limit );
+
+/// @brief Correct incremental position with absolute angle
+/// @param fusion Fusion handler
+/// @param angle_raw Absolute raw angle [0...16383]
+/// @param count Decoder count at moment of absolute angle read
+/// @return On OK return 0, MT6701_ERR_OUT_OF_RANGE if discrepancy above error_limit (correction still applied)
+uint8_t mt6701_fusion_correct( mt6701_fusion_t *fusion, uint16_t angle_raw, int32_t count );
+
+/// @brief Read absolute angle with mt6701_read_raw and correct incremental position.
+/// Count read before and after transaction, midpoint used as moment of read
+/// @param fusion Fusion handler
+/// @param handle mt6701 handler
+/// @param count_read Return current decoder count. Must be atomic against decoder ISR and refresh hardware counter if used
+/// @param obj Object passed to count_read
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_fusion_update( mt6701_fusion_t *fusion, mt6701_handle_t *handle, int32_t (*count_read)( void *obj ), void *obj );
+
+/// @brief Get fused multiturn position
+/// @param fusion Fusion handler
+/// @param count Current decoder count
+/// @return Position in raw units, 16384 per turn
+int32_t mt6701_fusion_position( const mt6701_fusion_t *fusion, int32_t count );
+
+/// @brief Get fused angle inside turn
+/// @param fusion Fusion handler
+/// @param count Current decoder count
+/// @return Raw angle [0...16383]
+uint16_t mt6701_fusion_angle_raw( const mt6701_fusion_t *fusion, int32_t count );
+
+/// @brief Reset health metrics (max error, faults, corrections count)
+/// @param fusion Fusion handler
+void mt6701_fusion_health_reset( mt6701_fusion_t *fusion );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_FUSION_H__
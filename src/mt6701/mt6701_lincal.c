@@ -0,0 +1,305 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_lincal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if (MT6701_LINCAL_HARMONICS < 1) || (MT6701_LINCAL_HARMONICS > 8)
+#error "MT6701_LINCAL_HARMONICS must be in range 1...8"
+#endif
+
+#if (MT6701_LINCAL_LUT_BITS < 4) || (MT6701_LINCAL_LUT_BITS > 8)
+#error "MT6701_LINCAL_LUT_BITS must be in range 4...8"
+#endif
+
+#define MT6701_LINCAL_MAGIC					0x4C
+#define MT6701_LINCAL_SHIFT					(14 - MT6701_LINCAL_LUT_BITS)
+#define MT6701_LINCAL_FRAC_MASK				((1 << MT6701_LINCAL_SHIFT) - 1)
+#define MT6701_LINCAL_TWO_PI				6.283185307179586
+
+// Index in packed upper triangle, row <= col
+#define MT6701_LINCAL_ATA(row, col)			((col) * ((col) + 1) / 2 + (row))
+
+static int16_t mt6701_lincal_wrap( int32_t value ){
+	return (int16_t)((int16_t)(value << 2) >> 2);
+}
+
+uint8_t mt6701_lincal_fit_init( mt6701_lincal_fit_t *fit, mt6701_lincal_mode_t mode ){
+	if(fit == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((mode != MT6701_LINCAL_MODE_REFERENCE) && (mode != MT6701_LINCAL_MODE_CONSTANT_SPEED)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	memset(fit, 0, sizeof(*fit));
+	fit->mode = mode;
+
+	return MT6701_OK;
+}
+
+// Model: y = c0 [+ c1 * t] + sum(ck * cos(k * angle) + sk * sin(k * angle))
+static void mt6701_lincal_fit_add( mt6701_lincal_fit_t *fit, uint16_t angle_raw, double t, double y ){
+	double phi[MT6701_LINCAL_PARAMS];
+	double angle;
+	uint8_t n = 0;
+	uint8_t k;
+	uint8_t row;
+	uint8_t col;
+
+	angle = (double)angle_raw * (MT6701_LINCAL_TWO_PI / 16384.0);
+
+	phi[n++] = 1.0;
+	if(fit->mode == MT6701_LINCAL_MODE_CONSTANT_SPEED){
+		phi[n++] = t;
+	}
+	for(k = 1; k <= MT6701_LINCAL_HARMONICS; k++){
+		phi[n++] = cos(angle * k);
+		phi[n++] = sin(angle * k);
+	}
+
+	for(col = 0; col < n; col++){
+		for(row = 0; row <= col; row++){
+			fit->ata[MT6701_LINCAL_ATA(row, col)] += phi[row] * phi[col];
+		}
+		fit->aty[col] += phi[col] * y;
+	}
+	fit->yy += y * y;
+	fit->samples++;
+}
+
+uint8_t mt6701_lincal_fit_add_reference( mt6701_lincal_fit_t *fit, uint16_t angle_raw, uint16_t reference_raw ){
+	if(fit == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(fit->mode != MT6701_LINCAL_MODE_REFERENCE){
+		return MT6701_ERR_CONFIG_UNAVAILABLE;
+	}
+
+	if((angle_raw >= 16384) || (reference_raw >= 16384)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	mt6701_lincal_fit_add(fit, angle_raw, 0.0, (double)mt6701_lincal_wrap((int32_t)angle_raw - reference_raw));
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_lincal_fit_add_timed( mt6701_lincal_fit_t *fit, uint16_t angle_raw, uint32_t time_us ){
+	if(fit == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(fit->mode != MT6701_LINCAL_MODE_CONSTANT_SPEED){
+		return MT6701_ERR_CONFIG_UNAVAILABLE;
+	}
+
+	if(angle_raw >= 16384){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if(fit->samples == 0){
+		fit->first_time = time_us;
+		fit->unwrapped = angle_raw;
+	}else{
+		fit->unwrapped += mt6701_lincal_wrap((int32_t)angle_raw - fit->last_raw);
+	}
+	fit->last_raw = angle_raw;
+
+	mt6701_lincal_fit_add(fit, angle_raw, (double)(time_us - fit->first_time) * 1e-6, (double)fit->unwrapped);
+
+	return MT6701_OK;
+}
+
+// Cholesky solve of normal equations, packed matrix decomposed in place
+static bool mt6701_lincal_solve( double *ata, const double *aty, double *x, uint8_t n ){
+	double sum;
+	uint8_t i;
+	uint8_t j;
+	uint8_t k;
+
+	for(j = 0; j < n; j++){
+		for(i = 0; i <= j; i++){
+			sum = ata[MT6701_LINCAL_ATA(i, j)];
+			for(k = 0; k < i; k++){
+				sum -= ata[MT6701_LINCAL_ATA(k, i)] * ata[MT6701_LINCAL_ATA(k, j)];
+			}
+			if(i == j){
+				if(sum <= 0.0){
+					return false;
+				}
+				ata[MT6701_LINCAL_ATA(i, j)] = sqrt(sum);
+			}else{
+				ata[MT6701_LINCAL_ATA(i, j)] = sum / ata[MT6701_LINCAL_ATA(i, i)];
+			}
+		}
+	}
+
+	// U^T * z = aty
+	for(i = 0; i < n; i++){
+		sum = aty[i];
+		for(k = 0; k < i; k++){
+			sum -= ata[MT6701_LINCAL_ATA(k, i)] * x[k];
+		}
+		x[i] = sum / ata[MT6701_LINCAL_ATA(i, i)];
+	}
+
+	// U * x = z
+	for(i = n; i-- > 0;){
+		sum = x[i];
+		for(k = i + 1; k < n; k++){
+			sum -= ata[MT6701_LINCAL_ATA(i, k)] * x[k];
+		}
+		x[i] = sum / ata[MT6701_LINCAL_ATA(i, i)];
+	}
+
+	return true;
+}
+
+uint8_t mt6701_lincal_fit_finish( mt6701_lincal_fit_t *fit, mt6701_lincal_t *cal, float *rms ){
+	double ata[MT6701_LINCAL_PARAMS * (MT6701_LINCAL_PARAMS + 1) / 2];
+	double residual;
+	double angle;
+	double error;
+	uint8_t n;
+	uint8_t first;
+	uint8_t i;
+	uint8_t k;
+
+	if((fit == NULL) || (cal == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	n = (fit->mode == MT6701_LINCAL_MODE_CONSTANT_SPEED) ? MT6701_LINCAL_PARAMS : (MT6701_LINCAL_PARAMS - 1);
+	if(fit->samples < (uint32_t)n * 4){
+		return MT6701_ERR_GENERAL;
+	}
+
+	memcpy(ata, fit->ata, sizeof(ata));
+	if(!mt6701_lincal_solve(ata, fit->aty, fit->coef, n)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	if(rms != NULL){
+		// Residual sum of squares: y'y - x'A'y for least squares solution
+		residual = fit->yy;
+		for(i = 0; i < n; i++){
+			residual -= fit->coef[i] * fit->aty[i];
+		}
+		if(residual < 0.0){
+			residual = 0.0;
+		}
+		*rms = (float)sqrt(residual / (double)fit->samples);
+	}
+
+	// Constant term is zero offset, not nonlinearity, table keeps harmonics only
+	first = n - 2 * MT6701_LINCAL_HARMONICS;
+	for(i = 0; i < MT6701_LINCAL_LUT_SIZE; i++){
+		angle = (double)i * (MT6701_LINCAL_TWO_PI / MT6701_LINCAL_LUT_SIZE);
+		error = 0.0;
+		for(k = 0; k < MT6701_LINCAL_HARMONICS; k++){
+			error += fit->coef[first + 2 * k] * cos(angle * (k + 1));
+			error += fit->coef[first + 2 * k + 1] * sin(angle * (k + 1));
+		}
+		if(error > 8191.0){
+			error = 8191.0;
+		}else if(error < -8192.0){
+			error = -8192.0;
+		}
+		cal->table[i] = (int16_t)lround(error);
+	}
+
+	return MT6701_OK;
+}
+
+uint16_t mt6701_lincal_apply( const mt6701_lincal_t *cal, uint16_t angle_raw ){
+	uint16_t index;
+	uint16_t frac;
+	int16_t error;
+	int16_t next;
+
+	index = (angle_raw >> MT6701_LINCAL_SHIFT) & (MT6701_LINCAL_LUT_SIZE - 1);
+	frac  = angle_raw & MT6701_LINCAL_FRAC_MASK;
+
+	error = cal->table[index];
+	next  = cal->table[(index + 1) & (MT6701_LINCAL_LUT_SIZE - 1)];
+	error += (int16_t)(((int32_t)(next - error) * frac) >> MT6701_LINCAL_SHIFT);
+
+	return (uint16_t)(angle_raw - error) & 0x3FFF;
+}
+
+uint16_t mt6701_lincal_serialize( const mt6701_lincal_t *cal, uint8_t *buf, uint16_t len ){
+	uint16_t i;
+
+	if((cal == NULL) || (buf == NULL) || (len < MT6701_LINCAL_SERIALIZED_SIZE)){
+		return 0;
+	}
+
+	buf[0] = MT6701_LINCAL_MAGIC;
+	buf[1] = MT6701_LINCAL_LUT_BITS;
+	for(i = 0; i < MT6701_LINCAL_LUT_SIZE; i++){
+		buf[2 + 2 * i]     = (uint8_t)((uint16_t)cal->table[i]);
+		buf[2 + 2 * i + 1] = (uint8_t)((uint16_t)cal->table[i] >> 8);
+	}
+	buf[MT6701_LINCAL_SERIALIZED_SIZE - 1] = mt6701_crc8(buf, MT6701_LINCAL_SERIALIZED_SIZE - 1);
+
+	return MT6701_LINCAL_SERIALIZED_SIZE;
+}
+
+uint8_t mt6701_lincal_deserialize( mt6701_lincal_t *cal, const uint8_t *buf, uint16_t len ){
+	uint16_t i;
+
+	if((cal == NULL) || (buf == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(len < MT6701_LINCAL_SERIALIZED_SIZE){
+		return MT6701_ERR_GENERAL;
+	}
+
+	if((buf[0] != MT6701_LINCAL_MAGIC) || (buf[1] != MT6701_LINCAL_LUT_BITS)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	if(mt6701_crc8(buf, MT6701_LINCAL_SERIALIZED_SIZE - 1) != buf[MT6701_LINCAL_SERIALIZED_SIZE - 1]){
+		return MT6701_ERR_GENERAL;
+	}
+
+	for(i = 0; i < MT6701_LINCAL_LUT_SIZE; i++){
+		cal->table[i] = (int16_t)((uint16_t)buf[2 + 2 * i] | ((uint16_t)buf[2 + 2 * i + 1] << 8));
+	}
+
+	return MT6701_OK;
+}
+
+void mt6701_lincal_clear( mt6701_lincal_t *cal ){
+	memset(cal->table, 0, sizeof(cal->table));
+}
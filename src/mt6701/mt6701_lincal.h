@@ -0,0 +1,131 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_LINCAL_H__
+#define MT6701_LINCAL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Harmonics in error model [1...8]
+#ifndef MT6701_LINCAL_HARMONICS
+#define MT6701_LINCAL_HARMONICS				4
+#endif
+
+// Correction table size 2^MT6701_LINCAL_LUT_BITS entries [4...8]
+#ifndef MT6701_LINCAL_LUT_BITS
+#define MT6701_LINCAL_LUT_BITS				6
+#endif
+
+#define MT6701_LINCAL_LUT_SIZE				(1 << MT6701_LINCAL_LUT_BITS)
+#define MT6701_LINCAL_PARAMS				(2 + 2 * MT6701_LINCAL_HARMONICS)
+#define MT6701_LINCAL_SERIALIZED_SIZE		(3 + 2 * MT6701_LINCAL_LUT_SIZE)
+
+typedef enum{
+	MT6701_LINCAL_MODE_REFERENCE,
+	MT6701_LINCAL_MODE_CONSTANT_SPEED,
+} mt6701_lincal_mode_t;
+
+// Least squares fit state. Double precision, on 8 bit MCU (double = float) run fit on host or 32 bit MCU
+typedef struct{
+	double ata[MT6701_LINCAL_PARAMS * (MT6701_LINCAL_PARAMS + 1) / 2];
+	double aty[MT6701_LINCAL_PARAMS];
+	double yy;
+	double coef[MT6701_LINCAL_PARAMS];
+	int32_t unwrapped;
+	uint32_t first_time;
+	uint32_t samples;
+	uint16_t last_raw;
+	mt6701_lincal_mode_t mode;
+} mt6701_lincal_fit_t;
+
+typedef struct{
+	int16_t table[MT6701_LINCAL_LUT_SIZE];
+} mt6701_lincal_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Start calibration data collection
+/// @param fit Fit handler
+/// @param mode MT6701_LINCAL_MODE_REFERENCE - samples with reference angle,
+/// MT6701_LINCAL_MODE_CONSTANT_SPEED - timestamped samples during constant speed rotation (integer number of turns recommended)
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_lincal_fit_init( mt6701_lincal_fit_t *fit, mt6701_lincal_mode_t mode );
+
+/// @brief Add sample with reference angle (MT6701_LINCAL_MODE_REFERENCE)
+/// @param fit Fit handler
+/// @param angle_raw Sensor raw angle [0...16383]
+/// @param reference_raw Reference raw angle [0...16383]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_lincal_fit_add_reference( mt6701_lincal_fit_t *fit, uint16_t angle_raw, uint16_t reference_raw );
+
+/// @brief Add timestamped sample (MT6701_LINCAL_MODE_CONSTANT_SPEED). Rotation between samples must be less than half turn
+/// @param fit Fit handler
+/// @param angle_raw Sensor raw angle [0...16383]
+/// @param time_us Sample timestamp in microseconds
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_lincal_fit_add_timed( mt6701_lincal_fit_t *fit, uint16_t angle_raw, uint32_t time_us );
+
+/// @brief Solve harmonic error model and build correction table
+/// @param fit Fit handler
+/// @param cal Correction table
+/// @param rms Residual RMS error after model in raw units, can be NULL
+/// @return On OK return 0, MT6701_ERR_GENERAL if not enough data
+uint8_t mt6701_lincal_fit_finish( mt6701_lincal_fit_t *fit, mt6701_lincal_t *cal, float *rms );
+
+/// @brief Apply correction to raw angle
+/// @param cal Correction table
+/// @param angle_raw Raw angle [0...16383]
+/// @return Corrected raw angle [0...16383]
+uint16_t mt6701_lincal_apply( const mt6701_lincal_t *cal, uint16_t angle_raw );
+
+/// @brief Serialize correction table (MT6701_LINCAL_SERIALIZED_SIZE bytes, with CRC8)
+/// @param cal Correction table
+/// @param buf Output buffer
+/// @param len Buffer size
+/// @return Bytes written, 0 if buffer too small
+uint16_t mt6701_lincal_serialize( const mt6701_lincal_t *cal, uint8_t *buf, uint16_t len );
+
+/// @brief Load correction table from serialized data
+/// @param cal Correction table
+/// @param buf Serialized data
+/// @param len Data length
+/// @return On OK return 0, MT6701_ERR_GENERAL on wrong format, table size or CRC
+uint8_t mt6701_lincal_deserialize( mt6701_lincal_t *cal, const uint8_t *buf, uint16_t len );
+
+/// @brief Clear correction table (no correction)
+/// @param cal Correction table
+void mt6701_lincal_clear( mt6701_lincal_t *cal );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_LINCAL_H__
@@ -0,0 +1,204 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_noise.h"
+#include <string.h>
+#include <math.h>
+
+#define MT6701_NOISE_RAW_RANGE				16384
+
+// Hysteresis settings ascending, width in raw units
+static const struct{
+	mt6701_hyst_t setting;
+	float width;
+} mt6701_noise_hyst[] = {
+	{ MT6701_HYST_0_25,	0.25f },
+	{ MT6701_HYST_0_5,	0.5f },
+	{ MT6701_HYST_1,	1.0f },
+	{ MT6701_HYST_2,	2.0f },
+	{ MT6701_HYST_4,	4.0f },
+	{ MT6701_HYST_8,	8.0f },
+};
+
+#define MT6701_NOISE_HYST_COUNT				(sizeof(mt6701_noise_hyst) / sizeof(mt6701_noise_hyst[0]))
+
+uint8_t mt6701_noise_init( mt6701_noise_t *noise ){
+	if(noise == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	memset(noise, 0, sizeof(mt6701_noise_t));
+
+	return MT6701_OK;
+}
+
+// Non overlapping Allan variance, averages of level k paired into level k+1
+static void mt6701_noise_allan_add( mt6701_noise_t *noise, float value ){
+	mt6701_noise_allan_t *level;
+	float diff;
+	uint8_t k;
+
+	for(k = 0; k < MT6701_NOISE_ALLAN_LEVELS; k++){
+		level = &noise->allan[k];
+		if(level->has_previous){
+			diff = value - level->previous;
+			level->sum_sq += diff * diff;
+			level->pairs++;
+		}
+		level->previous = value;
+		level->has_previous = true;
+
+		if(!level->has_pending){
+			level->pending = value;
+			level->has_pending = true;
+			return;
+		}
+		level->has_pending = false;
+		value = (level->pending + value) * 0.5f;
+	}
+}
+
+void mt6701_noise_add( mt6701_noise_t *noise, uint16_t angle_raw ){
+	int16_t delta;
+	float diff;
+	int16_t bin;
+
+	angle_raw &= MT6701_NOISE_RAW_RANGE - 1;
+	if(noise->samples == 0){
+		noise->reference = angle_raw;
+	}
+
+	delta = (int16_t)(angle_raw - noise->reference);
+	if(delta >= MT6701_NOISE_RAW_RANGE / 2){
+		delta -= MT6701_NOISE_RAW_RANGE;
+	}else if(delta < -MT6701_NOISE_RAW_RANGE / 2){
+		delta += MT6701_NOISE_RAW_RANGE;
+	}
+
+	noise->samples++;
+	diff = (float)delta - noise->mean;
+	noise->mean += diff / (float)noise->samples;
+	noise->m2 += diff * ((float)delta - noise->mean);
+
+	if((noise->samples == 1) || (delta < noise->min)){
+		noise->min = delta;
+	}
+	if((noise->samples == 1) || (delta > noise->max)){
+		noise->max = delta;
+	}
+
+	bin = delta + MT6701_NOISE_HIST_BINS / 2;
+	if(bin < 0){
+		bin = 0;
+	}else if(bin >= MT6701_NOISE_HIST_BINS){
+		bin = MT6701_NOISE_HIST_BINS - 1;
+	}
+	noise->histogram[bin]++;
+
+	mt6701_noise_allan_add(noise, (float)delta);
+}
+
+uint8_t mt6701_noise_capture( mt6701_noise_t *noise, mt6701_handle_t *handle, uint32_t samples ){
+	mt6701_sample_t sample;
+	uint8_t res;
+
+	if((noise == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	while(samples--){
+		res = mt6701_read_sample(handle, &sample);
+		if(res != MT6701_OK){
+			return res;
+		}
+		mt6701_noise_add(noise, sample.angle_raw);
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_noise_result( const mt6701_noise_t *noise, mt6701_noise_result_t *result ){
+	const mt6701_noise_allan_t *level;
+	float mean;
+	float band;
+	uint8_t i;
+
+	if((noise == NULL) || (result == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(noise->samples < 2){
+		return MT6701_ERR_UNINITITIALIZED;
+	}
+
+	memset(result, 0, sizeof(mt6701_noise_result_t));
+	result->samples = noise->samples;
+
+	mean = (float)noise->reference + noise->mean;
+	if(mean < 0.0f){
+		mean += MT6701_NOISE_RAW_RANGE;
+	}else if(mean >= MT6701_NOISE_RAW_RANGE){
+		mean -= MT6701_NOISE_RAW_RANGE;
+	}
+	result->mean = mean;
+	result->sigma = (float)sqrt(noise->m2 / (float)(noise->samples - 1));
+	result->peak_to_peak = (uint16_t)(noise->max - noise->min);
+
+	for(i = 0; i < MT6701_NOISE_ALLAN_LEVELS; i++){
+		level = &noise->allan[i];
+		if(level->pairs < MT6701_NOISE_ALLAN_MIN_PAIRS){
+			break;
+		}
+		result->adev[i] = (float)sqrt(level->sum_sq / (2.0f * (float)level->pairs));
+		if(result->adev[i] < result->adev[result->best_level]){
+			result->best_level = i;
+		}
+		result->adev_levels++;
+	}
+
+	// Hysteresis must cover noise band, else ABZ/UVW outputs toggle on stationary shaft
+	band = 6.0f * result->sigma;
+	result->hysteresis = mt6701_noise_hyst[MT6701_NOISE_HYST_COUNT - 1].setting;
+	for(i = 0; i < MT6701_NOISE_HYST_COUNT; i++){
+		if(mt6701_noise_hyst[i].width >= band){
+			result->hysteresis = mt6701_noise_hyst[i].setting;
+			break;
+		}
+	}
+
+	// IIR y += (x - y) / 2^s averages about 2^(s+1) samples, longer than optimal tau only adds lag and drift
+	if(result->best_level > 1){
+		result->iir_shift = (result->best_level > 9) ? 8 : (uint8_t)(result->best_level - 1);
+	}
+
+	result->deadband = (uint16_t)ceil(3.0f * result->sigma);
+	if(result->deadband == 0){
+		result->deadband = 1;
+	}
+
+	return MT6701_OK;
+}
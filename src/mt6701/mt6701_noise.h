@@ -0,0 +1,114 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_NOISE_H__
+#define MT6701_NOISE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Histogram bins, 1 raw LSB each, centered on first sample. Outliers counted in edge bins
+#ifndef MT6701_NOISE_HIST_BINS
+#define MT6701_NOISE_HIST_BINS				32
+#endif
+
+// Allan deviation levels, averaging time of level k is 2^k samples
+#ifndef MT6701_NOISE_ALLAN_LEVELS
+#define MT6701_NOISE_ALLAN_LEVELS			12
+#endif
+
+// Min differences of averages for level to be reported
+#ifndef MT6701_NOISE_ALLAN_MIN_PAIRS
+#define MT6701_NOISE_ALLAN_MIN_PAIRS		8
+#endif
+
+typedef struct{
+	float pending;
+	float previous;
+	float sum_sq;
+	uint32_t pairs;
+	bool has_pending;
+	bool has_previous;
+} mt6701_noise_allan_t;
+
+typedef struct{
+	uint32_t histogram[MT6701_NOISE_HIST_BINS];
+	mt6701_noise_allan_t allan[MT6701_NOISE_ALLAN_LEVELS];
+	uint32_t samples;
+	float mean;							// Relative to reference, raw units
+	float m2;
+	int16_t min;
+	int16_t max;
+	uint16_t reference;					// First sample
+} mt6701_noise_t;
+
+typedef struct{
+	float mean;							// Raw units [0...16383]
+	float sigma;						// Standard deviation, raw units
+	uint16_t peak_to_peak;				// Raw units
+	float adev[MT6701_NOISE_ALLAN_LEVELS];	// Allan deviation at 2^k samples, raw units, 0 if not enough data
+	uint8_t adev_levels;				// Reported levels
+	uint8_t best_level;					// Level with min Allan deviation, averaging longer only adds drift
+	mt6701_hyst_t hysteresis;			// Smallest setting covering +-3 sigma band
+	uint8_t iir_shift;					// For mt6701_filter_add_iir, 0 - filter not needed
+	uint16_t deadband;					// For mt6701_filter_add_deadband, 3 sigma
+	uint32_t samples;
+} mt6701_noise_result_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Reset statistics
+/// @param noise Statistics handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_noise_init( mt6701_noise_t *noise );
+
+/// @brief Add raw angle of stationary encoder, wrap at 0/16383 handled. Constant time and memory
+/// @param noise Statistics handler
+/// @param angle_raw Raw angle [0...16383]
+void mt6701_noise_add( mt6701_noise_t *noise, uint16_t angle_raw );
+
+/// @brief Read angles back to back (max rate) and add to statistics
+/// @param noise Statistics handler
+/// @param handle mt6701 handler
+/// @param samples Angles to read
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_noise_capture( mt6701_noise_t *noise, mt6701_handle_t *handle, uint32_t samples );
+
+/// @brief Compute statistics and recommend hysteresis and filter settings
+/// @param noise Statistics handler
+/// @param result Statistics and recommendations
+/// @return On OK return 0, MT6701_ERR_UNINITITIALIZED if less than 2 samples, else see MT6701_ERR codes
+uint8_t mt6701_noise_result( const mt6701_noise_t *noise, mt6701_noise_result_t *result );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_NOISE_H__
@@ -0,0 +1,396 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_profile.h"
+#include <string.h>
+
+#define MT6701_PROFILE_REG(block, reg)		((block)[(reg) - MT6701_PROFILE_REG_FIRST])
+
+// Registers with profile fields, other registers of block not touched
+static const uint8_t mt6701_profile_regs[] = {
+	MT6701_REG_UVM_MUX,
+	MT6701_REG_I2C_ADDR,
+	MT6701_REG_ABZ_MUX,
+	MT6701_REG_UVW_RES0,
+	MT6701_REG_ABZ_RES0,
+	MT6701_REG_ZERO8,
+	MT6701_REG_ZERO0,
+	MT6701_REG_HYST0,
+	MT6701_REG_PWM_FREQ,
+	MT6701_REG_A_START8,
+	MT6701_REG_A_START0,
+	MT6701_REG_A_STOP0,
+};
+
+#define MT6701_PROFILE_REGS_COUNT			(sizeof(mt6701_profile_regs) / sizeof(mt6701_profile_regs[0]))
+
+static uint8_t mt6701_profile_field( uint8_t reg, uint8_t mask, uint8_t pos ){
+	return (uint8_t)((reg & mask) >> pos);
+}
+
+static void mt6701_profile_field_set( uint8_t *reg, uint8_t mask, uint8_t pos, uint8_t value ){
+	*reg = (uint8_t)((*reg & ~mask) | ((value << pos) & mask));
+}
+
+void mt6701_profile_decode( const uint8_t *block, mt6701_profile_t *profile ){
+	profile->nanbnz = mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_UVM_MUX), MT6701_REG_UVM_MUX_MASK, MT6701_REG_UVM_MUX_POS) != 0;
+	profile->i2c_alternate = mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_I2C_ADDR), MT6701_REG_I2C_ADDR_ALT_MASK, MT6701_REG_I2C_ADDR_ALT_POS) != 0;
+	profile->uvw_mode = mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_ABZ_MUX), MT6701_REG_ABZ_MUX_MASK, MT6701_REG_ABZ_MUX_POS) != 0;
+	profile->direction = (mt6701_direction_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_DIR), MT6701_REG_DIR_MASK, MT6701_REG_DIR_POS);
+	profile->uvw_pole_pairs = (uint8_t)(mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_UVW_RES0), MT6701_REG_UVW_RES0_MASK, MT6701_REG_UVW_RES0_POS) + 1);
+	profile->abz_pulses = (uint16_t)(((uint16_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_ABZ_RES8), MT6701_REG_ABZ_RES8_MASK, MT6701_REG_ABZ_RES8_POS) << 8) |
+		MT6701_PROFILE_REG(block, MT6701_REG_ABZ_RES0)) + 1;
+	profile->zero = (uint16_t)((uint16_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_ZERO8), MT6701_REG_ZERO8_MASK, MT6701_REG_ZERO8_POS) << 8) |
+		MT6701_PROFILE_REG(block, MT6701_REG_ZERO0);
+	profile->pulse_width = (mt6701_pulse_width_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_PULSE_WIDTH), MT6701_REG_PULSE_WIDTH_MASK, MT6701_REG_PULSE_WIDTH_POS);
+	profile->hysteresis = (mt6701_hyst_t)((mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_HYST2), MT6701_REG_HYST2_MASK, MT6701_REG_HYST2_POS) << 2) |
+		mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_HYST0), MT6701_REG_HYST0_MASK, MT6701_REG_HYST0_POS));
+	profile->pwm_freq = (mt6701_pwm_freq_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_PWM_FREQ), MT6701_REG_PWM_FREQ_MASK, MT6701_REG_PWM_FREQ_POS);
+	profile->pwm_polarity = (mt6701_pwm_pol_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_PWM_POL), MT6701_REG_PWM_POL_MASK, MT6701_REG_PWM_POL_POS);
+	profile->out_mode = (mt6701_out_mode_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_OUT_MODE), MT6701_REG_OUT_MODE_MASK, MT6701_REG_OUT_MODE_POS);
+	profile->a_start = (uint16_t)((uint16_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_A_START8), MT6701_REG_A_START8_MASK, MT6701_REG_A_START8_POS) << 8) |
+		MT6701_PROFILE_REG(block, MT6701_REG_A_START0);
+	profile->a_stop = (uint16_t)((uint16_t)mt6701_profile_field(MT6701_PROFILE_REG(block, MT6701_REG_A_STOP8), MT6701_REG_A_STOP8_MASK, MT6701_REG_A_STOP8_POS) << 8) |
+		MT6701_PROFILE_REG(block, MT6701_REG_A_STOP0);
+}
+
+// Address bit not encoded, device keeps own address
+static void mt6701_profile_encode( const mt6701_profile_t *profile, uint8_t *block ){
+	uint16_t abz = profile->abz_pulses - 1;
+	uint16_t pole_pairs = profile->uvw_pole_pairs - 1;
+
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_UVM_MUX), MT6701_REG_UVM_MUX_MASK, MT6701_REG_UVM_MUX_POS, profile->nanbnz ? 1 : 0);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_ABZ_MUX), MT6701_REG_ABZ_MUX_MASK, MT6701_REG_ABZ_MUX_POS, profile->uvw_mode ? 1 : 0);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_DIR), MT6701_REG_DIR_MASK, MT6701_REG_DIR_POS, (uint8_t)profile->direction);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_UVW_RES0), MT6701_REG_UVW_RES0_MASK, MT6701_REG_UVW_RES0_POS, (uint8_t)pole_pairs);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_ABZ_RES8), MT6701_REG_ABZ_RES8_MASK, MT6701_REG_ABZ_RES8_POS, (uint8_t)(abz >> 8));
+	MT6701_PROFILE_REG(block, MT6701_REG_ABZ_RES0) = (uint8_t)abz;
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_ZERO8), MT6701_REG_ZERO8_MASK, MT6701_REG_ZERO8_POS, (uint8_t)(profile->zero >> 8));
+	MT6701_PROFILE_REG(block, MT6701_REG_ZERO0) = (uint8_t)profile->zero;
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_PULSE_WIDTH), MT6701_REG_PULSE_WIDTH_MASK, MT6701_REG_PULSE_WIDTH_POS, (uint8_t)profile->pulse_width);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_HYST2), MT6701_REG_HYST2_MASK, MT6701_REG_HYST2_POS, (uint8_t)(profile->hysteresis >> 2));
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_HYST0), MT6701_REG_HYST0_MASK, MT6701_REG_HYST0_POS, (uint8_t)(profile->hysteresis & 0x03));
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_PWM_FREQ), MT6701_REG_PWM_FREQ_MASK, MT6701_REG_PWM_FREQ_POS, (uint8_t)profile->pwm_freq);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_PWM_POL), MT6701_REG_PWM_POL_MASK, MT6701_REG_PWM_POL_POS, (uint8_t)profile->pwm_polarity);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_OUT_MODE), MT6701_REG_OUT_MODE_MASK, MT6701_REG_OUT_MODE_POS, (uint8_t)profile->out_mode);
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_A_START8), MT6701_REG_A_START8_MASK, MT6701_REG_A_START8_POS, (uint8_t)(profile->a_start >> 8));
+	MT6701_PROFILE_REG(block, MT6701_REG_A_START0) = (uint8_t)profile->a_start;
+	mt6701_profile_field_set(&MT6701_PROFILE_REG(block, MT6701_REG_A_STOP8), MT6701_REG_A_STOP8_MASK, MT6701_REG_A_STOP8_POS, (uint8_t)(profile->a_stop >> 8));
+	MT6701_PROFILE_REG(block, MT6701_REG_A_STOP0) = (uint8_t)profile->a_stop;
+}
+
+// Field by field, struct padding is not compared
+static bool mt6701_profile_equal( const mt6701_profile_t *a, const mt6701_profile_t *b ){
+	return (a->abz_pulses == b->abz_pulses) && (a->zero == b->zero) &&
+		(a->a_start == b->a_start) && (a->a_stop == b->a_stop) &&
+		(a->uvw_pole_pairs == b->uvw_pole_pairs) && (a->hysteresis == b->hysteresis) &&
+		(a->pulse_width == b->pulse_width) && (a->direction == b->direction) &&
+		(a->pwm_freq == b->pwm_freq) && (a->pwm_polarity == b->pwm_polarity) &&
+		(a->out_mode == b->out_mode) && (a->uvw_mode == b->uvw_mode) &&
+		(a->nanbnz == b->nanbnz);
+}
+
+static uint8_t mt6701_profile_block_read( mt6701_handle_t *handle, uint8_t *block ){
+	uint8_t res;
+	uint8_t i;
+
+	if(handle->i2c_read_burst != NULL){
+		return mt6701_reg_read_block(handle, MT6701_PROFILE_REG_FIRST, block, MT6701_PROFILE_REG_COUNT);
+	}
+
+	// Without burst support only registers with profile fields read
+	memset(block, 0, MT6701_PROFILE_REG_COUNT);
+	for(i = 0; i < MT6701_PROFILE_REGS_COUNT; i++){
+		res = mt6701_reg_read(handle, mt6701_profile_regs[i], &MT6701_PROFILE_REG(block, mt6701_profile_regs[i]));
+		if(res != MT6701_OK){
+			return res;
+		}
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_profile_read( mt6701_handle_t *handle, mt6701_profile_t *profile ){
+	uint8_t block[MT6701_PROFILE_REG_COUNT];
+	uint8_t res;
+
+	if((handle == NULL) || (profile == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	res = mt6701_profile_block_read(handle, block);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	mt6701_profile_decode(block, profile);
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_profile_validate( const mt6701_profile_t *profile ){
+	if((profile->abz_pulses < 1) || (profile->abz_pulses > 1024)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((profile->uvw_pole_pairs < 1) || (profile->uvw_pole_pairs > 16)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((profile->zero >= 4096) || (profile->a_start >= 4096) || (profile->a_stop >= 4096)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((profile->hysteresis > MT6701_HYST_0_5) || (profile->hysteresis == 0x4)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if(profile->pulse_width > MT6701_PULSE_WIDTH_180){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((profile->direction > MT6701_DIRECTION_CCW) || (profile->pwm_freq > MT6701_PWM_FREQ_497_2) ||
+	   (profile->pwm_polarity > MT6701_PWM_POL_LOW) || (profile->out_mode > MT6701_OUT_MODE_PWM)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	return MT6701_OK;
+}
+
+static uint8_t mt6701_profile_apply_locked( mt6701_handle_t *handle, const mt6701_profile_t *profile, bool program, uint8_t *written ){
+	uint8_t current[MT6701_PROFILE_REG_COUNT];
+	uint8_t block[MT6701_PROFILE_REG_COUNT];
+	mt6701_profile_t readback;
+	uint8_t count = 0;
+	uint8_t reg;
+	uint8_t res;
+	uint8_t i;
+
+	res = mt6701_profile_block_read(handle, current);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	memcpy(block, current, sizeof(block));
+	mt6701_profile_encode(profile, block);
+
+	for(i = 0; i < MT6701_PROFILE_REGS_COUNT; i++){
+		reg = mt6701_profile_regs[i];
+		if(MT6701_PROFILE_REG(block, reg) == MT6701_PROFILE_REG(current, reg)){
+			continue;
+		}
+		res = mt6701_reg_write(handle, reg, MT6701_PROFILE_REG(block, reg));
+		if(res != MT6701_OK){
+			return res;
+		}
+		count++;
+	}
+
+	if(written != NULL){
+		*written = count;
+	}
+
+	res = mt6701_profile_read(handle, &readback);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	if(!mt6701_profile_equal(&readback, profile)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	if(program){
+		return mt6701_programm_eeprom(handle);
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_profile_apply( mt6701_handle_t *handle, const mt6701_profile_t *profile, bool program, uint8_t *written ){
+	uint8_t res;
+
+	if((handle == NULL) || (profile == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(written != NULL){
+		*written = 0;
+	}
+
+	res = mt6701_profile_validate(profile);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	mt6701_bus_lock(handle);
+	res = mt6701_profile_apply_locked(handle, profile, program, written);
+	mt6701_bus_unlock(handle);
+
+	return res;
+}
+
+uint32_t mt6701_profile_clone( mt6701_handle_t *const *handles, uint8_t count, const mt6701_profile_t *profile, bool program ){
+	void (*delay)( uint32_t ms ) = NULL;
+	uint32_t done = 0;
+	uint8_t i;
+
+	if((handles == NULL) || (profile == NULL) || (count > 32)){
+		return 0;
+	}
+
+	for(i = 0; i < count; i++){
+		if(handles[i] == NULL){
+			continue;
+		}
+		if(mt6701_profile_apply(handles[i], profile, false, NULL) != MT6701_OK){
+			continue;
+		}
+		if(program){
+			if((handles[i]->delay == NULL) || (mt6701_programm_eeprom_start(handles[i]) != MT6701_OK)){
+				continue;
+			}
+			delay = handles[i]->delay;
+		}
+		done |= (uint32_t)1 << i;
+	}
+
+	if(delay != NULL){
+		delay(MT6701_EEPROM_PROGRAM_MS);
+	}
+
+	return done;
+}
+
+static void mt6701_profile_bits_put( uint8_t *buf, uint8_t *pos, uint16_t value, uint8_t bits ){
+	while(bits--){
+		if(value & 1){
+			buf[*pos >> 3] |= (uint8_t)(1 << (*pos & 7));
+		}
+		value >>= 1;
+		(*pos)++;
+	}
+}
+
+static uint16_t mt6701_profile_bits_get( const uint8_t *buf, uint8_t *pos, uint8_t bits ){
+	uint16_t value = 0;
+	uint8_t i;
+
+	for(i = 0; i < bits; i++){
+		if(buf[*pos >> 3] & (1 << (*pos & 7))){
+			value |= (uint16_t)(1 << i);
+		}
+		(*pos)++;
+	}
+
+	return value;
+}
+
+uint8_t mt6701_profile_serialize( const mt6701_profile_t *profile, uint8_t *buf, uint16_t size ){
+	uint8_t *packed;
+	uint8_t pos = 0;
+	uint8_t res;
+
+	if((profile == NULL) || (buf == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(size < MT6701_PROFILE_SERIALIZED_SIZE){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	res = mt6701_profile_validate(profile);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	memset(buf, 0, MT6701_PROFILE_SERIALIZED_SIZE);
+	buf[0] = MT6701_PROFILE_VERSION;
+	packed = &buf[1];
+
+	mt6701_profile_bits_put(packed, &pos, profile->abz_pulses - 1, 10);
+	mt6701_profile_bits_put(packed, &pos, profile->zero, 12);
+	mt6701_profile_bits_put(packed, &pos, profile->a_start, 12);
+	mt6701_profile_bits_put(packed, &pos, profile->a_stop, 12);
+	mt6701_profile_bits_put(packed, &pos, profile->uvw_pole_pairs - 1, 4);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->hysteresis, 3);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->pulse_width, 3);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->direction, 1);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->pwm_freq, 1);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->pwm_polarity, 1);
+	mt6701_profile_bits_put(packed, &pos, (uint16_t)profile->out_mode, 1);
+	mt6701_profile_bits_put(packed, &pos, profile->uvw_mode ? 1 : 0, 1);
+	mt6701_profile_bits_put(packed, &pos, profile->nanbnz ? 1 : 0, 1);
+	mt6701_profile_bits_put(packed, &pos, profile->i2c_alternate ? 1 : 0, 1);
+
+	buf[MT6701_PROFILE_SERIALIZED_SIZE - 1] = mt6701_crc8(buf, MT6701_PROFILE_SERIALIZED_SIZE - 1);
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_profile_deserialize( mt6701_profile_t *profile, const uint8_t *buf, uint16_t size ){
+	const uint8_t *packed;
+	mt6701_profile_t tmp;
+	uint8_t pos = 0;
+	uint8_t res;
+
+	if((profile == NULL) || (buf == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(size < MT6701_PROFILE_SERIALIZED_SIZE){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	if((buf[0] != MT6701_PROFILE_VERSION) || (mt6701_crc8(buf, MT6701_PROFILE_SERIALIZED_SIZE - 1) != buf[MT6701_PROFILE_SERIALIZED_SIZE - 1])){
+		return MT6701_ERR_GENERAL;
+	}
+	packed = &buf[1];
+
+	tmp.abz_pulses = mt6701_profile_bits_get(packed, &pos, 10) + 1;
+	tmp.zero = mt6701_profile_bits_get(packed, &pos, 12);
+	tmp.a_start = mt6701_profile_bits_get(packed, &pos, 12);
+	tmp.a_stop = mt6701_profile_bits_get(packed, &pos, 12);
+	tmp.uvw_pole_pairs = (uint8_t)(mt6701_profile_bits_get(packed, &pos, 4) + 1);
+	tmp.hysteresis = (mt6701_hyst_t)mt6701_profile_bits_get(packed, &pos, 3);
+	tmp.pulse_width = (mt6701_pulse_width_t)mt6701_profile_bits_get(packed, &pos, 3);
+	tmp.direction = (mt6701_direction_t)mt6701_profile_bits_get(packed, &pos, 1);
+	tmp.pwm_freq = (mt6701_pwm_freq_t)mt6701_profile_bits_get(packed, &pos, 1);
+	tmp.pwm_polarity = (mt6701_pwm_pol_t)mt6701_profile_bits_get(packed, &pos, 1);
+	tmp.out_mode = (mt6701_out_mode_t)mt6701_profile_bits_get(packed, &pos, 1);
+	tmp.uvw_mode = mt6701_profile_bits_get(packed, &pos, 1) != 0;
+	tmp.nanbnz = mt6701_profile_bits_get(packed, &pos, 1) != 0;
+	tmp.i2c_alternate = mt6701_profile_bits_get(packed, &pos, 1) != 0;
+
+	res = mt6701_profile_validate(&tmp);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	*profile = tmp;
+
+	return MT6701_OK;
+}
@@ -0,0 +1,114 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_PROFILE_H__
+#define MT6701_PROFILE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+#define MT6701_PROFILE_VERSION				1
+#define MT6701_PROFILE_SERIALIZED_SIZE		10		// Version, 63 packed bits, CRC8
+
+// Configuration registers block
+#define MT6701_PROFILE_REG_FIRST			0x25
+#define MT6701_PROFILE_REG_LAST				0x40
+#define MT6701_PROFILE_REG_COUNT			(MT6701_PROFILE_REG_LAST - MT6701_PROFILE_REG_FIRST + 1)
+
+typedef struct{
+	uint16_t abz_pulses;				// ABZ pulses per round [1...1024]
+	uint16_t zero;						// Zero offset [0...4095]
+	uint16_t a_start;					// Analog/PWM start [0...4095]
+	uint16_t a_stop;					// Analog/PWM stop [0...4095]
+	uint8_t uvw_pole_pairs;				// UVW pole pairs [1...16]
+	mt6701_hyst_t hysteresis;
+	mt6701_pulse_width_t pulse_width;
+	mt6701_direction_t direction;
+	mt6701_pwm_freq_t pwm_freq;
+	mt6701_pwm_pol_t pwm_polarity;
+	mt6701_out_mode_t out_mode;
+	bool uvw_mode;						// True - UVW, false - ABZ
+	bool nanbnz;						// -A-B-Z instead of UVW (QFN only)
+	bool i2c_alternate;					// Read only, apply keeps address of device
+} mt6701_profile_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Read all configuration (one burst read if i2c_read_burst set)
+/// @param handle mt6701 handler
+/// @param profile Read profile
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_profile_read( mt6701_handle_t *handle, mt6701_profile_t *profile );
+
+/// @brief Decode profile from configuration registers block, e.g. from diagnostic dump
+/// @param block MT6701_PROFILE_REG_COUNT registers starting from MT6701_PROFILE_REG_FIRST
+/// @param profile Decoded profile
+void mt6701_profile_decode( const uint8_t *block, mt6701_profile_t *profile );
+
+/// @brief Apply profile: registers read once, only changed registers written (reserved bits kept), then verified by readback
+/// @param handle mt6701 handler
+/// @param profile Profile to apply
+/// @param program True - save to EEPROM after verification
+/// @param written Count of written registers, can be NULL
+/// @return On OK return 0, MT6701_ERR_GENERAL on readback mismatch, else see MT6701_ERR codes
+uint8_t mt6701_profile_apply( mt6701_handle_t *handle, const mt6701_profile_t *profile, bool program, uint8_t *written );
+
+/// @brief Apply one profile to many chips. EEPROM programming started on all chips and waited once
+/// @param handles mt6701 handlers [1...32], NULL entries skipped
+/// @param count Handlers count
+/// @param profile Profile to apply
+/// @param program True - save to EEPROM after verification
+/// @return Bit mask of chips with applied (and programmed) profile
+uint32_t mt6701_profile_clone( mt6701_handle_t *const *handles, uint8_t count, const mt6701_profile_t *profile, bool program );
+
+/// @brief Check profile fields ranges
+/// @param profile Profile
+/// @return On OK return 0, else MT6701_ERR_OUT_OF_RANGE
+uint8_t mt6701_profile_validate( const mt6701_profile_t *profile );
+
+/// @brief Pack profile to MT6701_PROFILE_SERIALIZED_SIZE bytes (version, packed fields, CRC8)
+/// @param profile Profile
+/// @param buf Output buffer
+/// @param size Buffer size
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_profile_serialize( const mt6701_profile_t *profile, uint8_t *buf, uint16_t size );
+
+/// @brief Unpack and validate profile
+/// @param profile Profile
+/// @param buf Serialized profile
+/// @param size Buffer size
+/// @return On OK return 0, MT6701_ERR_GENERAL on version or CRC mismatch, else see MT6701_ERR codes
+uint8_t mt6701_profile_deserialize( mt6701_profile_t *profile, const uint8_t *buf, uint16_t size );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_PROFILE_H__
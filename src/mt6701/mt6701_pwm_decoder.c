@@ -0,0 +1,150 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_pwm_decoder.h"
+#include <stdlib.h>
+
+uint8_t mt6701_pwm_decoder_init( mt6701_pwm_decoder_t *decoder, uint32_t tick_hz, uint8_t time_bits, mt6701_pwm_freq_t frequency, mt6701_pwm_pol_t polarity, uint8_t tolerance ){
+	uint32_t period;
+
+	if(decoder == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((time_bits < 16) || (time_bits > 32) || (tolerance == 0) || (tolerance > 50) || (tick_hz == 0)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	// Nominal period in ticks: 1/994.4 Hz or 1/497.2 Hz
+	if(frequency == MT6701_PWM_FREQ_994_4){
+		period = (uint32_t)(((uint64_t)tick_hz * 10) / 9944);
+	}else if(frequency == MT6701_PWM_FREQ_497_2){
+		period = (uint32_t)(((uint64_t)tick_hz * 10) / 4972);
+	}else{
+		return MT6701_ERR_GENERAL;
+	}
+
+	decoder->time_mask = (time_bits == 32) ? 0xFFFFFFFFUL : ((1UL << time_bits) - 1);
+	if(period + period / 2 > decoder->time_mask){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	decoder->period_min = period - (period * tolerance) / 100;
+	decoder->period_max = period + (period * tolerance) / 100;
+	decoder->active_start = 0;
+	decoder->active_time = 0;
+	decoder->period = 0;
+	decoder->angle_raw = 0;
+	decoder->frames = 0;
+	decoder->errors = 0;
+	decoder->polarity = polarity;
+	decoder->edges = 0;
+	decoder->valid = false;
+
+	return MT6701_OK;
+}
+
+uint8_t MT6701_ISR_ATTR mt6701_pwm_decoder_angle( uint32_t active_time, uint32_t period, uint16_t *angle_raw ){
+	uint32_t clocks;
+	uint32_t margin;
+	uint16_t angle;
+	uint8_t res = MT6701_OK;
+
+	if(period == 0){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	// Rounded active time in PWM clocks, 64 bit to avoid overflow with fast timers
+	clocks = (uint32_t)(((uint64_t)active_time * MT6701_PWM_FRAME_CLOCKS + period / 2) / period);
+	// One timestamp tick in PWM clocks, allowed quantization error
+	margin = MT6701_PWM_FRAME_CLOCKS / period + 1;
+
+	if(clocks + margin < MT6701_PWM_HEADER_CLOCKS){
+		res = MT6701_ERR_OUT_OF_RANGE;
+		angle = 0;
+	}else if(clocks < MT6701_PWM_HEADER_CLOCKS){
+		angle = 0;
+	}else if(clocks > MT6701_PWM_HEADER_CLOCKS + 4095 + margin){
+		res = MT6701_ERR_OUT_OF_RANGE;
+		angle = 4095;
+	}else if(clocks > MT6701_PWM_HEADER_CLOCKS + 4095){
+		angle = 4095;
+	}else{
+		angle = (uint16_t)(clocks - MT6701_PWM_HEADER_CLOCKS);
+	}
+
+	if(angle_raw != NULL){
+		*angle_raw = angle;
+	}
+
+	return res;
+}
+
+bool MT6701_ISR_ATTR mt6701_pwm_decoder_edge( mt6701_pwm_decoder_t *decoder, bool level, uint32_t time ){
+	bool active;
+	uint32_t period;
+	uint16_t angle;
+
+	active = (decoder->polarity == MT6701_PWM_POL_LOW) ? !level : level;
+
+	if(!active){
+		// Active level end, need active start first
+		if(decoder->edges != 0){
+			decoder->active_time = (time - decoder->active_start) & decoder->time_mask;
+			decoder->edges = 2;
+		}
+		return false;
+	}
+
+	period = (time - decoder->active_start) & decoder->time_mask;
+	decoder->active_start = time;
+
+	if(decoder->edges != 2){
+		decoder->edges = 1;
+		return false;
+	}
+	decoder->edges = 1;
+
+	decoder->period = period;
+	if((period < decoder->period_min) || (period > decoder->period_max) || (decoder->active_time >= period)){
+		decoder->errors++;
+		decoder->valid = false;
+		return false;
+	}
+
+	if(mt6701_pwm_decoder_angle(decoder->active_time, period, &angle) != MT6701_OK){
+		decoder->errors++;
+		decoder->valid = false;
+		return false;
+	}
+
+	decoder->angle_raw = angle;
+	decoder->frames++;
+	decoder->valid = true;
+
+	return true;
+}
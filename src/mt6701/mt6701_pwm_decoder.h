@@ -0,0 +1,86 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_PWM_DECODER_H__
+#define MT6701_PWM_DECODER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// PWM frame: 16 clocks header, 4096 clocks data (angle), 7 clocks tail
+#define MT6701_PWM_FRAME_CLOCKS				4119
+#define MT6701_PWM_HEADER_CLOCKS			16
+
+typedef struct{
+	uint32_t time_mask;
+	uint32_t period_min;
+	uint32_t period_max;
+	uint32_t active_start;
+	uint32_t active_time;
+	uint32_t period;
+	volatile uint16_t angle_raw;
+	volatile uint16_t frames;
+	volatile uint16_t errors;
+	mt6701_pwm_pol_t polarity;
+	uint8_t edges;
+	volatile bool valid;
+} mt6701_pwm_decoder_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init PWM output decoder, settings must be same as in mt6701_pwm_freq_set and mt6701_pwm_polarity_set
+/// @param decoder PWM decoder handler
+/// @param tick_hz Timestamp ticks per second
+/// @param time_bits Timestamp width [16...32], for hardware timers without extension
+/// @param frequency MT6701_PWM_FREQ_994_4 or MT6701_PWM_FREQ_497_2
+/// @param polarity MT6701_PWM_POL_HIGH or MT6701_PWM_POL_LOW
+/// @param tolerance Allowed period deviation from nominal in percent [1...50]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_pwm_decoder_init( mt6701_pwm_decoder_t *decoder, uint32_t tick_hz, uint8_t time_bits, mt6701_pwm_freq_t frequency, mt6701_pwm_pol_t polarity, uint8_t tolerance );
+
+/// @brief Process PWM line edge, call from capture or pin change ISR
+/// @param decoder PWM decoder handler
+/// @param level Line level after edge
+/// @param time Edge timestamp in ticks
+/// @return True if new frame decoded on this edge
+bool mt6701_pwm_decoder_edge( mt6701_pwm_decoder_t *decoder, bool level, uint32_t time );
+
+/// @brief Convert measured active time and period to angle
+/// @param active_time Active level time (any units)
+/// @param period Frame period (same units)
+/// @param angle_raw Raw angle [0...4095]
+/// @return On OK return 0, MT6701_ERR_OUT_OF_RANGE if duty outside of frame
+uint8_t mt6701_pwm_decoder_angle( uint32_t active_time, uint32_t period, uint16_t *angle_raw );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_PWM_DECODER_H__
@@ -0,0 +1,107 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_slot.h"
+#include <stdlib.h>
+
+uint8_t mt6701_slot_init( mt6701_slot_t *slot ){
+	if(slot == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	slot->seq = 0;
+	slot->time_us = 0;
+	slot->angle_raw = 0;
+	slot->status = 0;
+	MT6701_BARRIER();
+
+	return MT6701_OK;
+}
+
+void mt6701_slot_write( mt6701_slot_t *slot, const mt6701_sample_t *sample, uint32_t time_us ){
+	mt6701_seq_t seq;
+
+	seq = slot->seq;
+	slot->seq = (mt6701_seq_t)(seq + 1);
+	MT6701_BARRIER();
+
+	slot->angle_raw = sample->angle_raw;
+	slot->status = sample->status;
+	slot->time_us = time_us;
+
+	MT6701_BARRIER();
+	slot->seq = (mt6701_seq_t)(seq + 2);
+}
+
+uint8_t mt6701_slot_update( mt6701_slot_t *slot, mt6701_handle_t *handle, uint32_t time_us ){
+	mt6701_sample_t sample;
+	uint8_t res;
+
+	res = mt6701_read_sample(handle, &sample);
+	if(res != MT6701_OK){
+		return res;
+	}
+
+	mt6701_slot_write(slot, &sample, time_us);
+
+	return MT6701_OK;
+}
+
+bool mt6701_slot_read( const mt6701_slot_t *slot, mt6701_sample_t *sample, uint32_t *time_us, mt6701_seq_t *seq ){
+	mt6701_seq_t seq_begin;
+	mt6701_seq_t seq_end;
+	uint32_t time_copy;
+	uint8_t attempt;
+
+	for(attempt = 0; attempt < MT6701_SLOT_RETRIES; attempt++){
+		seq_begin = slot->seq;
+		MT6701_BARRIER();
+		if(seq_begin & 1){
+			continue;
+		}
+
+		sample->angle_raw = slot->angle_raw;
+		sample->status = slot->status;
+		time_copy = slot->time_us;
+
+		MT6701_BARRIER();
+		seq_end = slot->seq;
+		if(seq_begin != seq_end){
+			continue;
+		}
+
+		if(time_us != NULL){
+			*time_us = time_copy;
+		}
+		if(seq != NULL){
+			*seq = seq_begin;
+		}
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,97 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_SLOT_H__
+#define MT6701_SLOT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Sequence counter must be written atomically by writer
+#if defined(__AVR__)
+typedef uint8_t mt6701_seq_t;
+#else
+typedef uint32_t mt6701_seq_t;
+#endif
+
+// Memory barrier between sequence and data access, hardware fence needed for multicore
+#ifndef MT6701_BARRIER
+#if defined(__GNUC__)
+#define MT6701_BARRIER()					__sync_synchronize()
+#else
+#define MT6701_BARRIER()
+#endif
+#endif
+
+// Read attempts before give up (writer preempted by reader, or too frequent writes)
+#ifndef MT6701_SLOT_RETRIES
+#define MT6701_SLOT_RETRIES					16
+#endif
+
+typedef struct{
+	volatile uint32_t time_us;
+	volatile uint16_t angle_raw;
+	volatile uint8_t status;
+	volatile mt6701_seq_t seq;		// Odd while write in progress
+} mt6701_slot_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init latest sample slot
+/// @param slot Slot handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_slot_init( mt6701_slot_t *slot );
+
+/// @brief Publish sample. Only one writer allowed (ISR or task)
+/// @param slot Slot handler
+/// @param sample Sample to publish
+/// @param time_us Sample timestamp
+void mt6701_slot_write( mt6701_slot_t *slot, const mt6701_sample_t *sample, uint32_t time_us );
+
+/// @brief Read sample from chip and publish it, for timer ISR
+/// @param slot Slot handler
+/// @param handle mt6701 handler
+/// @param time_us Sample timestamp
+/// @return On OK return 0, else see MT6701_ERR codes (slot not changed)
+uint8_t mt6701_slot_update( mt6701_slot_t *slot, mt6701_handle_t *handle, uint32_t time_us );
+
+/// @brief Copy latest sample without disabling interrupts. Any number of readers allowed
+/// @param slot Slot handler
+/// @param sample Sample copy
+/// @param time_us Sample timestamp, can be NULL
+/// @param seq Publication sequence, changes on every write (0 after init), can be NULL
+/// @return True if consistent copy done, false if writer was busy for MT6701_SLOT_RETRIES attempts
+bool mt6701_slot_read( const mt6701_slot_t *slot, mt6701_sample_t *sample, uint32_t *time_us, mt6701_seq_t *seq );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_SLOT_H__
@@ -0,0 +1,270 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_telemetry.h"
+#include <string.h>
+
+#if (MT6701_TELEMETRY_MAX_PAYLOAD < 16) || (MT6701_TELEMETRY_MAX_PAYLOAD > 250)
+#error "MT6701_TELEMETRY_MAX_PAYLOAD must be in range 16...250"
+#endif
+
+#define MT6701_TELEMETRY_STATE_SYNC			0
+#define MT6701_TELEMETRY_STATE_LEN			1
+#define MT6701_TELEMETRY_STATE_PAYLOAD		2
+#define MT6701_TELEMETRY_STATE_CRC			3
+
+static uint8_t mt6701_telemetry_varint( uint8_t *buf, uint32_t value ){
+	uint8_t len = 0;
+
+	while(value >= 0x80){
+		buf[len++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	buf[len++] = (uint8_t)value;
+
+	return len;
+}
+
+static uint8_t mt6701_telemetry_sample( mt6701_telemetry_encoder_t *encoder, const mt6701_sample_t *sample, uint32_t time_us, uint8_t *buf, bool key ){
+	uint8_t len = 0;
+	int16_t delta;
+	uint16_t zigzag;
+	bool status_changed;
+
+	if(key){
+		buf[len++] = (uint8_t)sample->angle_raw;
+		buf[len++] = (uint8_t)(sample->angle_raw >> 8);
+		buf[len++] = sample->status;
+		buf[len++] = (uint8_t)time_us;
+		buf[len++] = (uint8_t)(time_us >> 8);
+		buf[len++] = (uint8_t)(time_us >> 16);
+		buf[len++] = (uint8_t)(time_us >> 24);
+		return len;
+	}
+
+	// Shortest way around circle
+	delta = (int16_t)((uint16_t)(sample->angle_raw - encoder->last_angle) << 2) >> 2;
+	zigzag = (uint16_t)((delta < 0) ? ((uint16_t)(-delta) * 2 - 1) : ((uint16_t)delta * 2));
+	status_changed = (sample->status != encoder->last_status);
+
+	len += mt6701_telemetry_varint(&buf[len], ((uint32_t)zigzag << 1) | (status_changed ? 1 : 0));
+	if(status_changed){
+		buf[len++] = sample->status;
+	}
+	len += mt6701_telemetry_varint(&buf[len], time_us - encoder->last_time);
+
+	return len;
+}
+
+uint8_t mt6701_telemetry_encoder_init( mt6701_telemetry_encoder_t *encoder ){
+	if(encoder == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	encoder->len = 0;
+	encoder->last_time = 0;
+	encoder->last_angle = 0;
+	encoder->last_status = 0;
+
+	return MT6701_OK;
+}
+
+uint16_t mt6701_telemetry_flush( mt6701_telemetry_encoder_t *encoder, uint8_t *out, uint16_t out_size ){
+	uint16_t len;
+
+	if((encoder->len == 0) || (out == NULL) || (out_size < (uint16_t)encoder->len + 3)){
+		return 0;
+	}
+
+	out[0] = MT6701_TELEMETRY_SYNC;
+	out[1] = encoder->len;
+	memcpy(&out[2], encoder->payload, encoder->len);
+	out[2 + encoder->len] = mt6701_crc8(&out[1], (uint16_t)encoder->len + 1);
+
+	len = (uint16_t)encoder->len + 3;
+	encoder->len = 0;
+
+	return len;
+}
+
+uint16_t mt6701_telemetry_add( mt6701_telemetry_encoder_t *encoder, const mt6701_sample_t *sample, uint32_t time_us, uint8_t *out, uint16_t out_size ){
+	uint8_t buf[MT6701_TELEMETRY_SAMPLE_MAX];
+	uint8_t len;
+	uint16_t frame_len = 0;
+
+	if(encoder->len != 0){
+		len = mt6701_telemetry_sample(encoder, sample, time_us, buf, false);
+		if(encoder->len + len > MT6701_TELEMETRY_MAX_PAYLOAD){
+			frame_len = mt6701_telemetry_flush(encoder, out, out_size);
+			if(frame_len == 0){
+				// No space for completed frame, oldest samples dropped
+				encoder->len = 0;
+			}
+		}
+	}
+
+	if(encoder->len == 0){
+		len = mt6701_telemetry_sample(encoder, sample, time_us, buf, true);
+	}
+
+	memcpy(&encoder->payload[encoder->len], buf, len);
+	encoder->len += len;
+	encoder->last_angle = sample->angle_raw;
+	encoder->last_status = sample->status;
+	encoder->last_time = time_us;
+
+	return frame_len;
+}
+
+uint8_t mt6701_telemetry_decoder_init( mt6701_telemetry_decoder_t *decoder, mt6701_telemetry_callback_t callback, void *context ){
+	if(decoder == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	decoder->callback = callback;
+	decoder->context = context;
+	decoder->frames = 0;
+	decoder->errors = 0;
+	decoder->state = MT6701_TELEMETRY_STATE_SYNC;
+	decoder->frame[0] = 0;
+	decoder->pos = 0;
+
+	return MT6701_OK;
+}
+
+static bool mt6701_telemetry_varint_read( const uint8_t *buf, uint8_t len, uint8_t *pos, uint32_t *value ){
+	uint8_t shift = 0;
+
+	*value = 0;
+	while(*pos < len){
+		*value |= (uint32_t)(buf[*pos] & 0x7F) << shift;
+		if((buf[(*pos)++] & 0x80) == 0){
+			return true;
+		}
+		shift += 7;
+		if(shift > 28){
+			return false;
+		}
+	}
+
+	return false;
+}
+
+static void mt6701_telemetry_frame( mt6701_telemetry_decoder_t *decoder ){
+	const uint8_t *buf = &decoder->frame[1];
+	uint8_t len = decoder->frame[0];
+	mt6701_sample_t sample;
+	uint32_t time_us;
+	uint32_t value;
+	uint32_t dt;
+	uint16_t zigzag;
+	uint8_t pos = 0;
+
+	if(len < MT6701_TELEMETRY_KEY_SIZE){
+		decoder->errors++;
+		return;
+	}
+
+	sample.angle_raw = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
+	sample.status = buf[2];
+	time_us = (uint32_t)buf[3] | ((uint32_t)buf[4] << 8) | ((uint32_t)buf[5] << 16) | ((uint32_t)buf[6] << 24);
+	pos = MT6701_TELEMETRY_KEY_SIZE;
+	decoder->frames++;
+
+	if(decoder->callback != NULL){
+		decoder->callback(decoder->context, &sample, time_us);
+	}
+
+	while(pos < len){
+		if(!mt6701_telemetry_varint_read(buf, len, &pos, &value)){
+			decoder->errors++;
+			return;
+		}
+		if(value & 1){
+			if(pos >= len){
+				decoder->errors++;
+				return;
+			}
+			sample.status = buf[pos++];
+		}
+		if(!mt6701_telemetry_varint_read(buf, len, &pos, &dt)){
+			decoder->errors++;
+			return;
+		}
+
+		zigzag = (uint16_t)(value >> 1);
+		if(zigzag & 1){
+			sample.angle_raw = (uint16_t)(sample.angle_raw - (zigzag + 1) / 2) & 0x3FFF;
+		}else{
+			sample.angle_raw = (uint16_t)(sample.angle_raw + zigzag / 2) & 0x3FFF;
+		}
+		time_us += dt;
+
+		if(decoder->callback != NULL){
+			decoder->callback(decoder->context, &sample, time_us);
+		}
+	}
+}
+
+void mt6701_telemetry_decode( mt6701_telemetry_decoder_t *decoder, const uint8_t *data, uint32_t len ){
+	uint8_t byte;
+
+	while(len--){
+		byte = *data++;
+		switch(decoder->state){
+			case MT6701_TELEMETRY_STATE_SYNC:
+				if(byte == MT6701_TELEMETRY_SYNC){
+					decoder->state = MT6701_TELEMETRY_STATE_LEN;
+				}
+				break;
+			case MT6701_TELEMETRY_STATE_LEN:
+				if((byte == 0) || (byte > MT6701_TELEMETRY_MAX_PAYLOAD)){
+					decoder->state = (byte == MT6701_TELEMETRY_SYNC) ? MT6701_TELEMETRY_STATE_LEN : MT6701_TELEMETRY_STATE_SYNC;
+					decoder->errors++;
+					break;
+				}
+				decoder->frame[0] = byte;
+				decoder->pos = 1;
+				decoder->state = MT6701_TELEMETRY_STATE_PAYLOAD;
+				break;
+			case MT6701_TELEMETRY_STATE_PAYLOAD:
+				decoder->frame[decoder->pos++] = byte;
+				if(decoder->pos > decoder->frame[0]){
+					decoder->state = MT6701_TELEMETRY_STATE_CRC;
+				}
+				break;
+			default:
+				decoder->state = MT6701_TELEMETRY_STATE_SYNC;
+				if(mt6701_crc8(decoder->frame, (uint16_t)decoder->frame[0] + 1) != byte){
+					decoder->errors++;
+					break;
+				}
+				mt6701_telemetry_frame(decoder);
+				break;
+		}
+	}
+}
@@ -0,0 +1,111 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_TELEMETRY_H__
+#define MT6701_TELEMETRY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Frame: SYNC, payload length, payload, CRC8 (length and payload).
+// Payload: first sample - angle (u16 LE), status (u8), timestamp us (u32 LE);
+// next samples - varint(zigzag(angle delta) << 1 | status changed), [status], varint(time delta)
+#define MT6701_TELEMETRY_SYNC				0xA5
+#define MT6701_TELEMETRY_SAMPLE_MAX			9
+#define MT6701_TELEMETRY_KEY_SIZE			7
+
+// Max payload length [16...250]
+#ifndef MT6701_TELEMETRY_MAX_PAYLOAD
+#define MT6701_TELEMETRY_MAX_PAYLOAD		64
+#endif
+
+#define MT6701_TELEMETRY_MAX_FRAME			(MT6701_TELEMETRY_MAX_PAYLOAD + 3)
+
+typedef struct{
+	uint8_t payload[MT6701_TELEMETRY_MAX_PAYLOAD];
+	uint32_t last_time;
+	uint16_t last_angle;
+	uint8_t last_status;
+	uint8_t len;
+} mt6701_telemetry_encoder_t;
+
+typedef void (*mt6701_telemetry_callback_t)( void *context, const mt6701_sample_t *sample, uint32_t time_us );
+
+typedef struct{
+	uint8_t frame[MT6701_TELEMETRY_MAX_PAYLOAD + 1];	// Length byte and payload
+	mt6701_telemetry_callback_t callback;
+	void *context;
+	uint32_t frames;
+	uint32_t errors;
+	uint8_t state;
+	uint8_t pos;
+} mt6701_telemetry_decoder_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init telemetry encoder
+/// @param encoder Encoder handler
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_telemetry_encoder_init( mt6701_telemetry_encoder_t *encoder );
+
+/// @brief Add sample to current frame. If sample doesnt fit, current frame completed to out buffer and sample starts next frame
+/// @param encoder Encoder handler
+/// @param sample Sample from mt6701_read_sample
+/// @param time_us Sample timestamp in microseconds
+/// @param out Buffer for completed frame, at least MT6701_TELEMETRY_MAX_FRAME bytes
+/// @param out_size Buffer size
+/// @return Completed frame length, 0 if frame not completed yet
+uint16_t mt6701_telemetry_add( mt6701_telemetry_encoder_t *encoder, const mt6701_sample_t *sample, uint32_t time_us, uint8_t *out, uint16_t out_size );
+
+/// @brief Complete current frame, even if not full
+/// @param encoder Encoder handler
+/// @param out Buffer for completed frame, at least MT6701_TELEMETRY_MAX_FRAME bytes
+/// @param out_size Buffer size
+/// @return Completed frame length, 0 if no samples
+uint16_t mt6701_telemetry_flush( mt6701_telemetry_encoder_t *encoder, uint8_t *out, uint16_t out_size );
+
+/// @brief Init telemetry stream decoder
+/// @param decoder Decoder handler
+/// @param callback Called for every decoded sample
+/// @param context Passed to callback
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_telemetry_decoder_init( mt6701_telemetry_decoder_t *decoder, mt6701_telemetry_callback_t callback, void *context );
+
+/// @brief Feed stream bytes to decoder. Decoder resynchronizes on SYNC byte after broken frame
+/// @param decoder Decoder handler
+/// @param data Stream bytes
+/// @param len Bytes count
+void mt6701_telemetry_decode( mt6701_telemetry_decoder_t *decoder, const uint8_t *data, uint32_t len );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_TELEMETRY_H__
@@ -0,0 +1,409 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_trace.h"
+#include <string.h>
+
+// Any non zero code means bus error for driver
+#define MT6701_REPLAY_MISMATCH				0xFF
+
+typedef char mt6701_trace_entry_size_check[(sizeof(mt6701_trace_entry_t) == MT6701_TRACE_ENTRY_SIZE) ? 1 : -1];
+
+static mt6701_trace_entry_t *mt6701_trace_alloc( mt6701_trace_t *trace, uint8_t type, uint8_t reg ){
+	mt6701_trace_entry_t *entry;
+	uint16_t index;
+
+	index = trace->head + trace->count;
+	if(index >= trace->size){
+		index -= trace->size;
+	}
+	if(trace->count < trace->size){
+		trace->count++;
+	}else{
+		// Buffer full, overwrite oldest
+		trace->head++;
+		if(trace->head >= trace->size){
+			trace->head = 0;
+		}
+	}
+	trace->total++;
+
+	entry = &trace->buffer[index];
+	memset(entry, 0, sizeof(mt6701_trace_entry_t));
+	entry->type = type;
+	entry->reg = reg;
+
+	return entry;
+}
+
+static mt6701_trace_entry_t *mt6701_trace_push( mt6701_trace_t *trace, uint8_t type, uint8_t reg ){
+	mt6701_trace_entry_t *entry;
+	uint32_t now;
+	uint32_t dt = 0;
+
+	if(trace->micros != NULL){
+		now = trace->micros();
+		if(trace->total != 0){
+			dt = now - trace->last_time;
+			if(dt > 0xFFFF){
+				dt = 0xFFFF;
+			}
+		}
+		trace->last_time = now;
+	}
+
+	entry = mt6701_trace_alloc(trace, type, reg);
+	entry->dt[0] = (uint8_t)dt;
+	entry->dt[1] = (uint8_t)(dt >> 8);
+
+	return entry;
+}
+
+static uint8_t mt6701_trace_i2c_read( void *obj, uint8_t reg, uint8_t *data ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+	mt6701_trace_entry_t *entry;
+	uint8_t res;
+
+	res = trace->i2c_read(trace->i2c_object, reg, data);
+	entry = mt6701_trace_push(trace, MT6701_TRACE_I2C_READ, reg);
+	entry->data[0] = *data;
+	entry->result = res;
+
+	return res;
+}
+
+static uint8_t mt6701_trace_i2c_write( void *obj, uint8_t reg, uint8_t data ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+	mt6701_trace_entry_t *entry;
+	uint8_t res;
+
+	res = trace->i2c_write(trace->i2c_object, reg, data);
+	entry = mt6701_trace_push(trace, MT6701_TRACE_I2C_WRITE, reg);
+	entry->data[0] = data;
+	entry->result = res;
+
+	return res;
+}
+
+static uint8_t mt6701_trace_i2c_read_burst( void *obj, uint8_t reg, uint8_t *data, uint8_t len ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+	mt6701_trace_entry_t *entry;
+	uint8_t res;
+	uint8_t offset;
+	uint8_t chunk;
+
+	res = trace->i2c_read_burst(trace->i2c_object, reg, data, len);
+	entry = mt6701_trace_push(trace, MT6701_TRACE_I2C_BURST, reg);
+	entry->data[0] = len;
+	entry->result = res;
+
+	for(offset = 0; offset < len; offset += chunk){
+		chunk = (uint8_t)(len - offset);
+		if(chunk > sizeof(entry->data)){
+			chunk = sizeof(entry->data);
+		}
+		entry = mt6701_trace_alloc(trace, MT6701_TRACE_I2C_BURST_DATA, offset);
+		memcpy(entry->data, &data[offset], chunk);
+		entry->result = res;
+	}
+
+	return res;
+}
+
+static uint8_t mt6701_trace_i2c_recover( void *obj ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+
+	return trace->i2c_recover(trace->i2c_object);
+}
+
+static uint8_t mt6701_trace_ssi_read( void *obj, uint8_t *data, uint8_t len ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+	mt6701_trace_entry_t *entry;
+	uint8_t res;
+
+	if(trace->ssi_read_obj != NULL){
+		res = trace->ssi_read_obj(trace->ssi_object, data, len);
+	}else{
+		res = trace->ssi_read(data, len);
+	}
+	entry = mt6701_trace_push(trace, MT6701_TRACE_SSI_READ, len);
+	memcpy(entry->data, data, (len < sizeof(entry->data)) ? len : sizeof(entry->data));
+	entry->result = res;
+
+	return res;
+}
+
+static uint8_t mt6701_trace_ssi_clock_set( void *obj, uint32_t clock ){
+	mt6701_trace_t *trace = (mt6701_trace_t*)obj;
+
+	return trace->ssi_clock_set(trace->ssi_object, clock);
+}
+
+uint8_t mt6701_trace_start( mt6701_trace_t *trace, mt6701_handle_t *handle, mt6701_trace_entry_t *buffer, uint16_t size, uint32_t (*micros)( void ) ){
+	if((trace == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((buffer == NULL) || (size == 0)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	if(handle->initialized != true){
+		return MT6701_ERR_UNINITITIALIZED;
+	}
+
+	trace->buffer = buffer;
+	trace->size = size;
+	trace->head = 0;
+	trace->count = 0;
+	trace->total = 0;
+	trace->last_time = 0;
+	trace->micros = micros;
+
+	trace->i2c_object = handle->i2c_object;
+	trace->i2c_read = handle->i2c_read;
+	trace->i2c_write = handle->i2c_write;
+	trace->i2c_read_burst = handle->i2c_read_burst;
+	trace->i2c_recover = handle->i2c_recover;
+	trace->ssi_read = handle->ssi_read;
+	trace->ssi_object = handle->ssi_object;
+	trace->ssi_read_obj = handle->ssi_read_obj;
+	trace->ssi_clock_set = handle->ssi_clock_set;
+	trace->running = true;
+
+	if(handle->interface == MT6701_INTERFACE_I2C){
+		handle->i2c_object = trace;
+		handle->i2c_read = mt6701_trace_i2c_read;
+		handle->i2c_write = mt6701_trace_i2c_write;
+		if(handle->i2c_read_burst != NULL){
+			handle->i2c_read_burst = mt6701_trace_i2c_read_burst;
+		}
+		if(handle->i2c_recover != NULL){
+			handle->i2c_recover = mt6701_trace_i2c_recover;
+		}
+	}else{
+		handle->ssi_object = trace;
+		handle->ssi_read_obj = mt6701_trace_ssi_read;
+		if(handle->ssi_clock_set != NULL){
+			handle->ssi_clock_set = mt6701_trace_ssi_clock_set;
+		}
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_trace_stop( mt6701_trace_t *trace, mt6701_handle_t *handle ){
+	if((trace == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(trace->running != true){
+		return MT6701_ERR_GENERAL;
+	}
+
+	handle->i2c_object = trace->i2c_object;
+	handle->i2c_read = trace->i2c_read;
+	handle->i2c_write = trace->i2c_write;
+	handle->i2c_read_burst = trace->i2c_read_burst;
+	handle->i2c_recover = trace->i2c_recover;
+	handle->ssi_read = trace->ssi_read;
+	handle->ssi_object = trace->ssi_object;
+	handle->ssi_read_obj = trace->ssi_read_obj;
+	handle->ssi_clock_set = trace->ssi_clock_set;
+	trace->running = false;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_trace_get( const mt6701_trace_t *trace, uint16_t index, mt6701_trace_entry_t *entry ){
+	uint32_t pos;
+
+	if(trace == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((entry == NULL) || (index >= trace->count)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	pos = (uint32_t)trace->head + index;
+	if(pos >= trace->size){
+		pos -= trace->size;
+	}
+	memcpy(entry, &trace->buffer[pos], sizeof(mt6701_trace_entry_t));
+
+	return MT6701_OK;
+}
+
+static const mt6701_trace_entry_t *mt6701_replay_take( mt6701_replay_t *replay, uint8_t type, uint8_t reg ){
+	const mt6701_trace_entry_t *entry;
+
+	if(replay->pos >= replay->count){
+		replay->mismatches++;
+		return NULL;
+	}
+
+	entry = &replay->entries[replay->pos];
+	if((entry->type != type) || (entry->reg != reg)){
+		replay->mismatches++;
+		return NULL;
+	}
+	replay->pos++;
+
+	return entry;
+}
+
+static uint8_t mt6701_replay_i2c_read( void *obj, uint8_t reg, uint8_t *data ){
+	const mt6701_trace_entry_t *entry;
+
+	entry = mt6701_replay_take((mt6701_replay_t*)obj, MT6701_TRACE_I2C_READ, reg);
+	if(entry == NULL){
+		return MT6701_REPLAY_MISMATCH;
+	}
+
+	*data = entry->data[0];
+	return entry->result;
+}
+
+static uint8_t mt6701_replay_i2c_write( void *obj, uint8_t reg, uint8_t data ){
+	mt6701_replay_t *replay = (mt6701_replay_t*)obj;
+	const mt6701_trace_entry_t *entry;
+
+	entry = mt6701_replay_take(replay, MT6701_TRACE_I2C_WRITE, reg);
+	if(entry == NULL){
+		return MT6701_REPLAY_MISMATCH;
+	}
+
+	if(entry->data[0] != data){
+		// Driver wrote different value than in recorded session
+		replay->mismatches++;
+	}
+	return entry->result;
+}
+
+static uint8_t mt6701_replay_i2c_read_burst( void *obj, uint8_t reg, uint8_t *data, uint8_t len ){
+	mt6701_replay_t *replay = (mt6701_replay_t*)obj;
+	const mt6701_trace_entry_t *entry;
+	uint8_t recorded;
+	uint8_t offset;
+	uint8_t i;
+	uint8_t res;
+
+	entry = mt6701_replay_take(replay, MT6701_TRACE_I2C_BURST, reg);
+	if(entry == NULL){
+		return MT6701_REPLAY_MISMATCH;
+	}
+	recorded = entry->data[0];
+	res = entry->result;
+
+	for(offset = 0; offset < recorded; offset += sizeof(entry->data)){
+		entry = mt6701_replay_take(replay, MT6701_TRACE_I2C_BURST_DATA, offset);
+		if(entry == NULL){
+			return MT6701_REPLAY_MISMATCH;
+		}
+		for(i = 0; (i < sizeof(entry->data)) && (offset + i < len); i++){
+			data[offset + i] = entry->data[i];
+		}
+	}
+
+	if(recorded != len){
+		// Driver requested different length than in recorded session
+		replay->mismatches++;
+		return MT6701_REPLAY_MISMATCH;
+	}
+	return res;
+}
+
+static uint8_t mt6701_replay_ssi_read( void *obj, uint8_t *data, uint8_t len ){
+	const mt6701_trace_entry_t *entry;
+
+	entry = mt6701_replay_take((mt6701_replay_t*)obj, MT6701_TRACE_SSI_READ, len);
+	if(entry == NULL){
+		return MT6701_REPLAY_MISMATCH;
+	}
+
+	memcpy(data, entry->data, (len < sizeof(entry->data)) ? len : sizeof(entry->data));
+	return entry->result;
+}
+
+uint8_t mt6701_replay_attach( mt6701_replay_t *replay, mt6701_handle_t *handle, const mt6701_trace_entry_t *entries, uint16_t count ){
+	bool burst = false;
+	uint16_t i;
+
+	if((replay == NULL) || (handle == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((entries == NULL) && (count != 0)){
+		return MT6701_ERR_GENERAL;
+	}
+
+	replay->entries = entries;
+	replay->count = count;
+	replay->pos = 0;
+	replay->mismatches = 0;
+
+	// Burst of ring start overwritten, its data unusable
+	while((replay->pos < count) && (entries[replay->pos].type == MT6701_TRACE_I2C_BURST_DATA)){
+		replay->pos++;
+	}
+	// Driver uses burst reads only if recorded session did
+	for(i = 0; i < count; i++){
+		if(entries[i].type == MT6701_TRACE_I2C_BURST){
+			burst = true;
+			break;
+		}
+	}
+
+	handle->i2c_object = replay;
+	handle->i2c_read = mt6701_replay_i2c_read;
+	handle->i2c_write = mt6701_replay_i2c_write;
+	handle->i2c_read_burst = burst ? mt6701_replay_i2c_read_burst : NULL;
+	handle->i2c_recover = NULL;
+	handle->ssi_object = replay;
+	handle->ssi_read_obj = mt6701_replay_ssi_read;
+	handle->ssi_clock_set = NULL;
+
+	return mt6701_init(handle);
+}
+
+const mt6701_trace_entry_t *mt6701_replay_next( const mt6701_replay_t *replay ){
+	if(replay->pos >= replay->count){
+		return NULL;
+	}
+
+	return &replay->entries[replay->pos];
+}
+
+void mt6701_replay_skip( mt6701_replay_t *replay ){
+	if(replay->pos < replay->count){
+		replay->pos++;
+	}
+	while((replay->pos < replay->count) && (replay->entries[replay->pos].type == MT6701_TRACE_I2C_BURST_DATA)){
+		replay->pos++;
+	}
+}
@@ -0,0 +1,130 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_TRACE_H__
+#define MT6701_TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+#define MT6701_TRACE_I2C_READ				0
+#define MT6701_TRACE_I2C_WRITE				1
+#define MT6701_TRACE_SSI_READ				2
+#define MT6701_TRACE_I2C_BURST				3	// reg - first register, data[0] - length, followed by BURST_DATA entries
+#define MT6701_TRACE_I2C_BURST_DATA			4	// reg - byte offset in burst, data - up to 3 bytes, dt always 0
+
+// Bytes only, so entry can be sent/stored as is on any platform
+typedef struct{
+	uint8_t type;		// MT6701_TRACE_x
+	uint8_t reg;		// I2C register or SSI length
+	uint8_t data[3];	// I2C data in data[0], SSI frame
+	uint8_t result;		// Callback return code
+	uint8_t dt[2];		// Time from previous transaction in us (LE, saturated at 65535)
+} mt6701_trace_entry_t;
+
+#define MT6701_TRACE_ENTRY_SIZE				8
+
+typedef struct{
+	mt6701_trace_entry_t *buffer;
+	uint16_t size;
+	uint16_t head;
+	uint16_t count;
+	uint32_t total;
+	uint32_t last_time;
+	uint32_t (*micros)( void );
+	// Original handle callbacks
+	void *i2c_object;
+	uint8_t (*i2c_read)( void *obj, uint8_t reg, uint8_t *data );
+	uint8_t (*i2c_write)( void *obj, uint8_t reg, uint8_t data );
+	uint8_t (*i2c_read_burst)( void *obj, uint8_t reg, uint8_t *data, uint8_t len );
+	uint8_t (*i2c_recover)( void *obj );
+	uint8_t (*ssi_read)( uint8_t *data, uint8_t len );
+	void *ssi_object;
+	uint8_t (*ssi_read_obj)( void *obj, uint8_t *data, uint8_t len );
+	uint8_t (*ssi_clock_set)( void *obj, uint32_t clock );
+	bool running;
+} mt6701_trace_t;
+
+typedef struct{
+	const mt6701_trace_entry_t *entries;
+	uint16_t count;
+	uint16_t pos;
+	uint32_t mismatches;
+} mt6701_replay_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Start recording of all bus transactions of driver. Buffer works as ring, latest transactions kept.
+/// I2C burst read recorded as MT6701_TRACE_I2C_BURST entry and one MT6701_TRACE_I2C_BURST_DATA entry per 3 bytes.
+/// Oldest entries can be BURST_DATA of overwritten burst, skip them when decoding
+/// @param trace Trace handler
+/// @param handle Initialized mt6701 handler, its bus callbacks replaced until mt6701_trace_stop
+/// @param buffer Entries buffer
+/// @param size Buffer size in entries
+/// @param micros Timestamp source in us, can be NULL (dt not recorded)
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_trace_start( mt6701_trace_t *trace, mt6701_handle_t *handle, mt6701_trace_entry_t *buffer, uint16_t size, uint32_t (*micros)( void ) );
+
+/// @brief Stop recording and restore original bus callbacks
+/// @param trace Trace handler
+/// @param handle mt6701 handler, passed to mt6701_trace_start
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_trace_stop( mt6701_trace_t *trace, mt6701_handle_t *handle );
+
+/// @brief Get recorded entry
+/// @param trace Trace handler
+/// @param index Entry index, 0 - oldest kept entry
+/// @param entry Entry copy
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_trace_get( const mt6701_trace_t *trace, uint16_t index, mt6701_trace_entry_t *entry );
+
+/// @brief Attach replay backend to handler, driver bus transactions answered from recorded trace.
+/// I2C burst reads replayed only if trace contains them, leading BURST_DATA entries skipped
+/// @param replay Replay handler
+/// @param handle mt6701 handler with selected interface and delay callback, mt6701_init called inside
+/// @param entries Recorded entries
+/// @param count Entries count
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_replay_attach( mt6701_replay_t *replay, mt6701_handle_t *handle, const mt6701_trace_entry_t *entries, uint16_t count );
+
+/// @brief Peek next entry for replay
+/// @param replay Replay handler
+/// @return Next entry, NULL if trace ended
+const mt6701_trace_entry_t *mt6701_replay_next( const mt6701_replay_t *replay );
+
+/// @brief Skip next entry (transaction of unknown driver call), with its BURST_DATA entries
+/// @param replay Replay handler
+void mt6701_replay_skip( mt6701_replay_t *replay );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_TRACE_H__
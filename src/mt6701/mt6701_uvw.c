@@ -0,0 +1,122 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_uvw.h"
+#include <stdlib.h>
+
+// Hall sequence forward: 100, 110, 010, 011, 001, 101
+static const uint8_t MT6701_ISR_DATA mt6701_uvw_sector_table[8] = {
+	MT6701_UVW_SECTOR_INVALID, 4, 2, 3, 0, 5, 1, MT6701_UVW_SECTOR_INVALID,
+};
+
+uint8_t mt6701_uvw_init( mt6701_uvw_t *uvw, uint8_t pole_pairs ){
+	if(uvw == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((pole_pairs == 0) || (pole_pairs > 16)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	uvw->last_time = 0;
+	uvw->period = 0;
+	uvw->steps = 0;
+	uvw->errors = 0;
+	uvw->pole_pairs = pole_pairs;
+	uvw->sector = MT6701_UVW_SECTOR_INVALID;
+	uvw->direction = 0;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_uvw_sector( uint8_t state ){
+	return mt6701_uvw_sector_table[state & 0x07];
+}
+
+uint8_t MT6701_ISR_ATTR mt6701_uvw_update( mt6701_uvw_t *uvw, uint8_t state, uint32_t time_us ){
+	uint8_t sector;
+	uint8_t diff;
+
+	sector = mt6701_uvw_sector_table[state & 0x07];
+	if(sector == MT6701_UVW_SECTOR_INVALID){
+		uvw->errors++;
+		return sector;
+	}
+
+	if(sector == uvw->sector){
+		return sector;
+	}
+
+	if(uvw->sector == MT6701_UVW_SECTOR_INVALID){
+		uvw->sector = sector;
+		uvw->last_time = time_us;
+		return sector;
+	}
+
+	diff = (uint8_t)((sector + 6 - uvw->sector) % 6);
+	if(diff == 1){
+		uvw->steps++;
+		uvw->direction = 1;
+	}else if(diff == 5){
+		uvw->steps--;
+		uvw->direction = -1;
+	}else{
+		// Sector skipped, direction unknown, speed estimation restarted
+		uvw->errors++;
+		uvw->direction = 0;
+	}
+
+	uvw->period = time_us - uvw->last_time;
+	uvw->last_time = time_us;
+	uvw->sector = sector;
+
+	return sector;
+}
+
+float mt6701_uvw_rpm( const mt6701_uvw_t *uvw, uint32_t time_us ){
+	uint32_t period;
+	uint32_t elapsed;
+
+	if((uvw->direction == 0) || (uvw->period == 0)){
+		return 0.0f;
+	}
+
+	// If no transition for longer than last period, speed decays
+	period = uvw->period;
+	elapsed = time_us - uvw->last_time;
+	if(elapsed > period){
+		period = elapsed;
+	}
+
+	// One sector - 1/6 of electrical turn
+	return (float)uvw->direction * (10000000.0f / ((float)period * (float)uvw->pole_pairs));
+}
+
+void MT6701_ISR_ATTR mt6701_uvw_nanbnz_update( mt6701_abz_t *abz, uint8_t state ){
+	mt6701_abz_edge(abz, !(state & MT6701_UVW_STATE_U), !(state & MT6701_UVW_STATE_V));
+	mt6701_abz_index(abz, !(state & MT6701_UVW_STATE_W));
+}
@@ -0,0 +1,90 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_UVW_H__
+#define MT6701_UVW_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+#include "mt6701_abz.h"
+
+#define MT6701_UVW_SECTOR_INVALID			0xFF
+
+// UVW state bits, state = U << 2 | V << 1 | W
+#define MT6701_UVW_STATE_U					0x04
+#define MT6701_UVW_STATE_V					0x02
+#define MT6701_UVW_STATE_W					0x01
+
+typedef struct{
+	uint32_t last_time;
+	uint32_t period;
+	volatile int32_t steps;
+	volatile uint16_t errors;
+	uint8_t pole_pairs;
+	uint8_t sector;
+	int8_t direction;
+} mt6701_uvw_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init UVW decoder, pole pairs must be same as in mt6701_uvw_pole_pair_set
+/// @param uvw UVW decoder handler
+/// @param pole_pairs Pole pairs [1...16]
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_uvw_init( mt6701_uvw_t *uvw, uint8_t pole_pairs );
+
+/// @brief Map UVW state to commutation sector
+/// @param state UVW state (U << 2 | V << 1 | W)
+/// @return Sector [0...5] or MT6701_UVW_SECTOR_INVALID for 000 and 111 states
+uint8_t mt6701_uvw_sector( uint8_t state );
+
+/// @brief Process UVW state change, call from ISR on any line change
+/// @param uvw UVW decoder handler
+/// @param state UVW state (U << 2 | V << 1 | W)
+/// @param time_us Timestamp in microseconds
+/// @return Sector [0...5] or MT6701_UVW_SECTOR_INVALID
+uint8_t mt6701_uvw_update( mt6701_uvw_t *uvw, uint8_t state, uint32_t time_us );
+
+/// @brief Get mechanical speed, estimated from time between sector transitions
+/// @param uvw UVW decoder handler
+/// @param time_us Current timestamp in microseconds
+/// @return Speed in RPM, negative for backward rotation
+float mt6701_uvw_rpm( const mt6701_uvw_t *uvw, uint32_t time_us );
+
+/// @brief Process nAnBnZ state (QFN version with mt6701_nanbnz_enable), U/V/W lines carry inverted A/B/Z
+/// @param abz ABZ decoder handler
+/// @param state UVW lines state (U << 2 | V << 1 | W)
+void mt6701_uvw_nanbnz_update( mt6701_abz_t *abz, uint8_t state );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_UVW_H__
@@ -0,0 +1,182 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_vernier.h"
+#include <stddef.h>
+
+#define MT6701_VERNIER_RAW_RANGE			16384
+
+// Inverse of value mod modulus by extended Euclid, 0 if not coprime
+static uint16_t mt6701_vernier_inverse( uint16_t value, uint16_t modulus ){
+	int32_t t = 0;
+	int32_t new_t = 1;
+	int32_t r = modulus;
+	int32_t new_r = value % modulus;
+	int32_t q;
+	int32_t tmp;
+
+	if(modulus == 1){
+		return 0;
+	}
+
+	while(new_r != 0){
+		q = r / new_r;
+		tmp = t - q * new_t;
+		t = new_t;
+		new_t = tmp;
+		tmp = r - q * new_r;
+		r = new_r;
+		new_r = tmp;
+	}
+
+	if(r != 1){
+		return 0;
+	}
+	if(t < 0){
+		t += modulus;
+	}
+
+	return (uint16_t)t;
+}
+
+uint8_t mt6701_vernier_init( mt6701_vernier_t *vernier, const uint16_t *teeth, uint8_t channels, uint8_t reversed ){
+	uint32_t turns = 1;
+	uint8_t k;
+
+	if((vernier == NULL) || (teeth == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	// Solver unusable until all teeth validated
+	vernier->channels = 0;
+
+	if((channels < 2) || (channels > MT6701_VERNIER_MAX_CHANNELS)){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	vernier->reversed = reversed;
+	vernier->tolerance = MT6701_VERNIER_TOLERANCE;
+	vernier->teeth[0] = teeth[0];
+	vernier->inverse[0] = 0;
+
+	for(k = 1; k < channels; k++){
+		if((teeth[0] == 0) || (teeth[k] < 2)){
+			return MT6701_ERR_OUT_OF_RANGE;
+		}
+		vernier->teeth[k] = teeth[k];
+		vernier->inverse[k] = mt6701_vernier_inverse(teeth[0], teeth[k]);
+		if(vernier->inverse[k] == 0){
+			return MT6701_ERR_OUT_OF_RANGE;
+		}
+		turns *= teeth[k];
+		// Position in raw units must fit 32 bit
+		if(turns > (0xFFFFFFFFUL / MT6701_VERNIER_RAW_RANGE)){
+			return MT6701_ERR_OUT_OF_RANGE;
+		}
+	}
+
+	if(channels == 3){
+		vernier->inverse[0] = mt6701_vernier_inverse(teeth[1], teeth[2]);
+		if(vernier->inverse[0] == 0){
+			return MT6701_ERR_OUT_OF_RANGE;
+		}
+	}
+	vernier->turns = turns;
+	vernier->channels = channels;
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_vernier_solve( const mt6701_vernier_t *vernier, const uint16_t *angles_raw, mt6701_vernier_result_t *result ){
+	uint32_t remainder[MT6701_VERNIER_MAX_CHANNELS] = {0};
+	uint16_t residual_max = 0;
+	uint16_t angle_main;
+	uint16_t angle;
+	uint32_t turn;
+	uint32_t diff;
+	int32_t error;
+	int32_t rounded;
+	int32_t residual;
+	uint8_t k;
+
+	if((vernier == NULL) || (angles_raw == NULL)){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if((vernier->channels < 2) || (vernier->channels > MT6701_VERNIER_MAX_CHANNELS)){
+		return MT6701_ERR_UNINITITIALIZED;
+	}
+
+	angle_main = angles_raw[0] & (MT6701_VERNIER_RAW_RANGE - 1);
+	if(vernier->reversed & 0x01){
+		angle_main = (MT6701_VERNIER_RAW_RANGE - angle_main) & (MT6701_VERNIER_RAW_RANGE - 1);
+	}
+
+	for(k = 1; k < vernier->channels; k++){
+		angle = angles_raw[k] & (MT6701_VERNIER_RAW_RANGE - 1);
+		if(vernier->reversed & (1 << k)){
+			angle = (MT6701_VERNIER_RAW_RANGE - angle) & (MT6701_VERNIER_RAW_RANGE - 1);
+		}
+
+		// teeth[k] * secondary = (turn + main) * teeth[0] mod teeth[k], so rounded difference is turn * teeth[0] mod teeth[k]
+		error = (int32_t)angle * vernier->teeth[k] - (int32_t)angle_main * vernier->teeth[0];
+		error += MT6701_VERNIER_RAW_RANGE / 2;
+		rounded = (error >= 0) ? (error / MT6701_VERNIER_RAW_RANGE) : -((-error + MT6701_VERNIER_RAW_RANGE - 1) / MT6701_VERNIER_RAW_RANGE);
+		residual = error - MT6701_VERNIER_RAW_RANGE / 2 - rounded * MT6701_VERNIER_RAW_RANGE;
+		if(residual < 0){
+			residual = -residual;
+		}
+		if(residual > residual_max){
+			residual_max = (uint16_t)residual;
+		}
+
+		rounded %= (int32_t)vernier->teeth[k];
+		if(rounded < 0){
+			rounded += vernier->teeth[k];
+		}
+		remainder[k] = ((uint32_t)rounded * vernier->inverse[k]) % vernier->teeth[k];
+	}
+
+	// Chinese remainder theorem: turn = r1 mod teeth[1], turn = r2 mod teeth[2]
+	turn = remainder[1];
+	if(vernier->channels == 3){
+		diff = (remainder[2] + vernier->teeth[2] - (turn % vernier->teeth[2])) % vernier->teeth[2];
+		turn += (uint32_t)vernier->teeth[1] * ((diff * vernier->inverse[0]) % vernier->teeth[2]);
+	}
+
+	if(result != NULL){
+		result->turn = turn;
+		result->position = turn * MT6701_VERNIER_RAW_RANGE + angle_main;
+		result->residual = residual_max;
+	}
+
+	if(residual_max > vernier->tolerance){
+		return MT6701_ERR_GENERAL;
+	}
+
+	return MT6701_OK;
+}
@@ -0,0 +1,83 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_VERNIER_H__
+#define MT6701_VERNIER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Main shaft and up to 2 secondary shafts
+#define MT6701_VERNIER_MAX_CHANNELS			3
+
+// Max vernier residual, raw units. Residual grows with angle errors of all sensors
+// multiplied by teeth counts and with shaft speed between readings, must stay below 8192
+#ifndef MT6701_VERNIER_TOLERANCE
+#define MT6701_VERNIER_TOLERANCE			2048
+#endif
+
+typedef struct{
+	uint16_t teeth[MT6701_VERNIER_MAX_CHANNELS];	// Secondary shaft k makes teeth[0]/teeth[k] turns per main shaft turn
+	uint16_t inverse[MT6701_VERNIER_MAX_CHANNELS];	// [k] - inverse of teeth[0] mod teeth[k], [0] - inverse of teeth[1] mod teeth[2]
+	uint32_t turns;						// Absolute range, main shaft turns
+	uint16_t tolerance;					// Max residual, raw units
+	uint8_t channels;
+	uint8_t reversed;					// Bit k - sensor k rotates opposite to main shaft (gears mesh)
+} mt6701_vernier_t;
+
+typedef struct{
+	uint32_t position;					// Main shaft raw position [0...turns * 16384 - 1]
+	uint32_t turn;						// Main shaft turn [0...turns - 1]
+	uint16_t residual;					// Max absolute residual of secondary channels, raw units
+} mt6701_vernier_result_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init solver, precompute modular inverses. Teeth counts of secondaries must be coprime to main and to each other,
+/// absolute range is product of secondary teeth counts
+/// @param vernier Solver
+/// @param teeth [0] - main shaft gear, [1...channels-1] - secondary shafts gears
+/// @param channels Sensors count [2...MT6701_VERNIER_MAX_CHANNELS]
+/// @param reversed Bit k set if sensor k rotates opposite to main shaft
+/// @return On OK return 0, MT6701_ERR_OUT_OF_RANGE if teeth not coprime or range too large (solver left unusable), else see MT6701_ERR codes
+uint8_t mt6701_vernier_init( mt6701_vernier_t *vernier, const uint16_t *teeth, uint8_t channels, uint8_t reversed );
+
+/// @brief Absolute multi-turn position from synchronized raw angles, integer math only
+/// @param vernier Solver
+/// @param angles_raw Raw angles [0...16383], [0] - main shaft sensor
+/// @param result Position, can be NULL
+/// @return On OK return 0, MT6701_ERR_GENERAL if residual above tolerance (readings inconsistent), MT6701_ERR_UNINITITIALIZED if init failed, else see MT6701_ERR codes
+uint8_t mt6701_vernier_solve( const mt6701_vernier_t *vernier, const uint16_t *angles_raw, mt6701_vernier_result_t *result );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_VERNIER_H__
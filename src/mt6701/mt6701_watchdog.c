@@ -0,0 +1,118 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mt6701_watchdog.h"
+#include <stdlib.h>
+
+uint8_t mt6701_watchdog_init( mt6701_watchdog_t *watchdog, uint8_t mask, uint8_t debounce, mt6701_watchdog_callback_t on_enter, mt6701_watchdog_callback_t on_exit, void *context ){
+	uint8_t i;
+
+	if(watchdog == NULL){
+		return MT6701_ERR_HANDLER_NULL;
+	}
+
+	if(debounce == 0){
+		return MT6701_ERR_OUT_OF_RANGE;
+	}
+
+	watchdog->on_enter = on_enter;
+	watchdog->on_exit = on_exit;
+	watchdog->context = context;
+	watchdog->mask = mask;
+	watchdog->debounce = debounce;
+	watchdog->active = 0;
+	watchdog->latched = 0;
+	for(i = 0; i < MT6701_WATCHDOG_FLAGS_COUNT; i++){
+		watchdog->counter[i] = 0;
+	}
+
+	return MT6701_OK;
+}
+
+uint8_t mt6701_watchdog_update( mt6701_watchdog_t *watchdog, const mt6701_sample_t *sample ){
+	uint8_t flags;
+	uint8_t known;
+	uint8_t entered = 0;
+	uint8_t exited = 0;
+	uint8_t active;
+	uint8_t bit;
+	uint8_t i;
+
+	active = watchdog->active;
+
+	if(sample == NULL){
+		// Status unknown on failed read, only bus error evaluated
+		flags = active | MT6701_WATCHDOG_BUS_ERROR;
+		known = MT6701_WATCHDOG_BUS_ERROR;
+	}else if(sample->status & MT6701_SAMPLE_STATUS_VALID){
+		flags = sample->status & (MT6701_WATCHDOG_FIELD_STRONG | MT6701_WATCHDOG_FIELD_WEAK | MT6701_WATCHDOG_BUTTON | MT6701_WATCHDOG_TRACK_LOSS);
+		known = 0xFF;
+	}else{
+		flags = (uint8_t)(active & ~MT6701_WATCHDOG_BUS_ERROR);
+		known = MT6701_WATCHDOG_BUS_ERROR;
+	}
+
+	for(i = 0; i < MT6701_WATCHDOG_FLAGS_COUNT; i++){
+		bit = (uint8_t)(1 << i);
+		if(((watchdog->mask & known & bit) == 0) || ((flags & bit) == (active & bit))){
+			watchdog->counter[i] = 0;
+			continue;
+		}
+
+		watchdog->counter[i]++;
+		if(watchdog->counter[i] >= watchdog->debounce){
+			watchdog->counter[i] = 0;
+			if(flags & bit){
+				entered |= bit;
+			}else{
+				exited |= bit;
+			}
+		}
+	}
+
+	active = (uint8_t)((active | entered) & ~exited);
+	watchdog->active = active;
+	watchdog->latched |= entered;
+
+	if((entered != 0) && (watchdog->on_enter != NULL)){
+		watchdog->on_enter(watchdog->context, entered, active);
+	}
+
+	if((exited != 0) && (watchdog->on_exit != NULL)){
+		watchdog->on_exit(watchdog->context, exited, active);
+	}
+
+	return active;
+}
+
+uint8_t mt6701_watchdog_latched( const mt6701_watchdog_t *watchdog ){
+	return watchdog->latched;
+}
+
+void mt6701_watchdog_clear( mt6701_watchdog_t *watchdog ){
+	watchdog->latched = watchdog->active;
+}
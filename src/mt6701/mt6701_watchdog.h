@@ -0,0 +1,95 @@
+/*
+
+This is a library for MT6701 encoder IC sensor.
+
+MIT License
+
+Copyright (c) 2024 I_AM_ENGINEER
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MT6701_WATCHDOG_H__
+#define MT6701_WATCHDOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mt6701.h"
+
+// Fault flags, same layout as sample status bits
+#define MT6701_WATCHDOG_FIELD_STRONG		0x01
+#define MT6701_WATCHDOG_FIELD_WEAK			0x02
+#define MT6701_WATCHDOG_BUTTON				0x04
+#define MT6701_WATCHDOG_TRACK_LOSS			0x08
+#define MT6701_WATCHDOG_BUS_ERROR			0x10
+#define MT6701_WATCHDOG_FLAGS_COUNT			5
+
+#define MT6701_WATCHDOG_FAULTS				(MT6701_WATCHDOG_FIELD_STRONG | MT6701_WATCHDOG_FIELD_WEAK | MT6701_WATCHDOG_TRACK_LOSS | MT6701_WATCHDOG_BUS_ERROR)
+
+/// @brief Watchdog event callback
+/// @param context User context
+/// @param changed Flags entered (or exited) on this sample
+/// @param active All active flags after this sample
+typedef void (*mt6701_watchdog_callback_t)( void *context, uint8_t changed, uint8_t active );
+
+typedef struct{
+	mt6701_watchdog_callback_t on_enter;
+	mt6701_watchdog_callback_t on_exit;
+	void *context;
+	uint8_t counter[MT6701_WATCHDOG_FLAGS_COUNT];
+	uint8_t mask;
+	uint8_t debounce;
+	volatile uint8_t active;
+	volatile uint8_t latched;
+} mt6701_watchdog_t;
+
+#ifdef __cplusplus
+extern "C"{
+#endif 
+
+/// @brief Init watchdog. Status bits available only with SSI, with I2C only bus errors monitored
+/// @param watchdog Watchdog handler
+/// @param mask Monitored MT6701_WATCHDOG_x flags, MT6701_WATCHDOG_FAULTS for all faults
+/// @param debounce Consecutive samples required for flag enter/exit [1...255]
+/// @param on_enter Called when flags become active, can be NULL
+/// @param on_exit Called when flags become inactive, can be NULL
+/// @param context Passed to callbacks
+/// @return On OK return 0, else see MT6701_ERR codes
+uint8_t mt6701_watchdog_init( mt6701_watchdog_t *watchdog, uint8_t mask, uint8_t debounce, mt6701_watchdog_callback_t on_enter, mt6701_watchdog_callback_t on_exit, void *context );
+
+/// @brief Update watchdog with sample, already read by application
+/// @param watchdog Watchdog handler
+/// @param sample Sample from mt6701_read_sample, NULL if read failed
+/// @return Active flags
+uint8_t mt6701_watchdog_update( mt6701_watchdog_t *watchdog, const mt6701_sample_t *sample );
+
+/// @brief Get sticky flags, set on every enter and kept until mt6701_watchdog_clear
+/// @param watchdog Watchdog handler
+/// @return Latched flags
+uint8_t mt6701_watchdog_latched( const mt6701_watchdog_t *watchdog );
+
+/// @brief Clear latched flags. Still active flags stay latched
+/// @param watchdog Watchdog handler
+void mt6701_watchdog_clear( mt6701_watchdog_t *watchdog );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MT6701_WATCHDOG_H__